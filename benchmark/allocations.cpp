@@ -0,0 +1,89 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "allocations.hpp"
+
+namespace simple_json::benchmark {
+Allocations allocations;
+
+/** The size of the prefix storing the size of a block, keeping the blocks aligned. */
+static constexpr std::size_t prefixSize = alignof(std::max_align_t);
+
+/**
+ * Allocates and counts a block of the given size.
+ *
+ * @param size the size of the block
+ * @return the block or @c nullptr if the allocation failed
+ */
+static inline auto allocate(std::size_t size) -> void* {
+    const auto block = static_cast<char*>(std::malloc(size + prefixSize));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    std::memcpy(block, &size, sizeof(size));
+    ++allocations.count;
+    allocations.bytes   += size;
+    allocations.current += size;
+    allocations.peak     = std::max(allocations.peak, allocations.current);
+    return block + prefixSize;
+}
+
+/**
+ * Deallocates a block allocated by @c allocate() .
+ *
+ * @param pointer the block
+ */
+static inline void deallocate(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    const auto block = static_cast<char*>(pointer) - prefixSize;
+    std::size_t size;
+    std::memcpy(&size, block, sizeof(size));
+    allocations.current -= size;
+    std::free(block);
+}
+}
+
+auto operator new(std::size_t size) -> void* {
+    if (const auto block = simple_json::benchmark::allocate(size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return operator new(size);
+}
+
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return simple_json::benchmark::allocate(size);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return simple_json::benchmark::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept                          { simple_json::benchmark::deallocate(pointer); }
+void operator delete[](void* pointer) noexcept                        { simple_json::benchmark::deallocate(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept             { simple_json::benchmark::deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept           { simple_json::benchmark::deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept   { simple_json::benchmark::deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { simple_json::benchmark::deallocate(pointer); }
@@ -0,0 +1,46 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_benchmark_allocations_hpp
+#define SimpleJSON_benchmark_allocations_hpp
+
+#include <cstddef>
+
+namespace simple_json::benchmark {
+/**
+ * The counters of the allocations made through the global allocation
+ * functions.
+ */
+struct Allocations {
+    /** The amount of allocations so far.                    */
+    std::size_t count   = 0;
+    /** The amount of bytes allocated so far.                */
+    std::size_t bytes   = 0;
+    /** The amount of bytes currently allocated.             */
+    std::size_t current = 0;
+    /** The maximum of the currently allocated bytes so far. */
+    std::size_t peak    = 0;
+};
+
+/**
+ * @brief The counters of the allocations of the program.
+ *
+ * The global allocation functions are replaced by counting ones. The
+ * counters are not synchronized: only single-threaded code is measured.
+ */
+extern Allocations allocations;
+}
+
+#endif /* SimpleJSON_benchmark_allocations_hpp */
@@ -0,0 +1,342 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdint>
+#include <string_view>
+
+#include <SimpleJSON/Writer.hpp>
+
+#include "corpus.hpp"
+
+namespace simple_json::benchmark {
+/** The approximate size of a corpus at scale 1 in bytes. */
+static constexpr std::size_t baseSize = 4 << 20;
+
+/**
+ * A pseudo random number generator (xorshift64*), independent of the
+ * standard library implementation.
+ */
+class Random {
+    /** The state of the generator. */
+    std::uint64_t state = 0x9e3779b97f4a7c15;
+
+public:
+    /**
+     * Returns the next random number.
+     *
+     * @return the random number
+     */
+    inline auto next() -> std::uint64_t {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545f4914f6cdd1d;
+    }
+
+    /**
+     * Returns a random number below the given bound.
+     *
+     * @param bound the exclusive upper bound
+     * @return the random number
+     */
+    inline auto below(std::uint64_t bound) -> std::uint64_t {
+        return next() % bound;
+    }
+
+    /**
+     * Returns a random number between zero and one.
+     *
+     * @return the random number
+     */
+    inline auto unit() -> double {
+        return static_cast<double>(next() >> 11) / static_cast<double>(1ull << 53);
+    }
+
+    /**
+     * Returns @c true with the given probability.
+     *
+     * @param probability the probability
+     * @return the random boolean
+     */
+    inline auto chance(double probability) -> bool {
+        return unit() < probability;
+    }
+};
+
+/** The words the texts are made of, including some non-ASCII ones. */
+static constexpr std::string_view words[] = {
+    "the", "parser", "json", "value", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "release",
+    "today", "build", "fast", "memory", "\"quoted\"", "line\nbreak", "tab\there", "caf\xc3\xa9", "na\xc3\xafve",
+    "\xe6\x97\xa5\xe6\x9c\xac", "\xf0\x9f\x9a\x80", "path\\to", "#json", "@someone", "https://example.com/x",
+};
+
+/**
+ * Appends random words to the given string.
+ *
+ * @param random the random number generator
+ * @param string the string
+ * @param count the amount of words
+ */
+static inline void appendWords(Random& random, std::string& string, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            string.push_back(' ');
+        }
+        string.append(words[random.below(std::size(words))]);
+    }
+}
+
+/**
+ * Writes a tweet-like record.
+ *
+ * @param random the random number generator
+ * @param writer the writer
+ * @param id the identifier of the record
+ */
+static inline void writeTweet(Random& random, Writer& writer, long id) {
+    std::string text;
+    appendWords(random, text, 8 + random.below(16));
+
+    writer.startObject();
+    writer.key("id");
+    writer.integer(1'000'000'000'000'000'000 + id);
+    writer.key("id_str");
+    writer.string(std::to_string(1'000'000'000'000'000'000 + id));
+    writer.key("created_at");
+    writer.string("Mon Sep 24 03:35:21 +0000 2012");
+    writer.key("text");
+    writer.string(text);
+    writer.key("truncated");
+    writer.boolean(random.chance(0.1));
+    writer.key("in_reply_to_status_id");
+    if (random.chance(0.3)) {
+        writer.integer(static_cast<long>(random.below(1'000'000'000)));
+    } else {
+        writer.null();
+    }
+    writer.key("user");
+    writer.startObject();
+    writer.key("id");
+    writer.integer(static_cast<long>(random.below(100'000'000)));
+    writer.key("name");
+    writer.string("user" + std::to_string(random.below(100'000)));
+    writer.key("screen_name");
+    writer.string("screen_name_" + std::to_string(id));
+    writer.key("description");
+    std::string description;
+    appendWords(random, description, random.below(12));
+    writer.string(description);
+    writer.key("followers_count");
+    writer.integer(static_cast<long>(random.below(1'000'000)));
+    writer.key("verified");
+    writer.boolean(random.chance(0.05));
+    writer.endObject();
+    writer.key("entities");
+    writer.startObject();
+    writer.key("hashtags");
+    writer.startArray();
+    for (auto i = random.below(4); i > 0; --i) {
+        writer.startObject();
+        writer.key("text");
+        writer.string(words[random.below(std::size(words))]);
+        writer.key("indices");
+        writer.startArray();
+        writer.integer(static_cast<long>(random.below(70)));
+        writer.integer(static_cast<long>(70 + random.below(70)));
+        writer.endArray();
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.key("urls");
+    writer.startArray();
+    writer.endArray();
+    writer.endObject();
+    writer.key("coordinates");
+    if (random.chance(0.2)) {
+        writer.startArray();
+        writer.floating(random.unit() * 360 - 180);
+        writer.floating(random.unit() * 180 - 90);
+        writer.endArray();
+    } else {
+        writer.null();
+    }
+    writer.key("retweet_count");
+    writer.integer(static_cast<long>(random.below(10'000)));
+    writer.key("favorited");
+    writer.boolean(random.chance(0.2));
+    writer.key("lang");
+    writer.string(random.chance(0.8) ? "en" : "ja");
+    writer.endObject();
+}
+
+/**
+ * Generates an array of tweet-like records.
+ *
+ * @param size the approximate size in bytes
+ * @param pretty whether to pretty-print the data
+ * @return the corpus
+ */
+static inline auto generateTwitter(std::size_t size, bool pretty) -> Corpus {
+    Random random;
+    Writer writer({ pretty });
+    writer.startArray();
+    for (long id = 0; writer.getBuffer().size() < size; ++id) {
+        writeTweet(random, writer, id);
+    }
+    writer.endArray();
+    return { pretty ? "twitter-pretty" : "twitter", writer.take(), 1, false };
+}
+
+/**
+ * Generates newline delimited tweet-like records.
+ *
+ * @param size the approximate size in bytes
+ * @return the corpus
+ */
+static inline auto generateDelimited(std::size_t size) -> Corpus {
+    Random random;
+    std::string data;
+    std::size_t documents = 0;
+    for (long id = 0; data.size() < size; ++id, ++documents) {
+        Writer writer;
+        writeTweet(random, writer, id);
+        data.append(writer.getBuffer());
+        data.push_back('\n');
+    }
+    return { "ndjson", std::move(data), documents, true };
+}
+
+/**
+ * Generates arrays of coordinates and integers.
+ *
+ * @param size the approximate size in bytes
+ * @return the corpus
+ */
+static inline auto generateNumbers(std::size_t size) -> Corpus {
+    Random random;
+    Writer writer;
+    writer.startObject();
+    writer.key("coordinates");
+    writer.startArray();
+    while (writer.getBuffer().size() < size * 3 / 4) {
+        writer.startArray();
+        writer.floating(random.unit() * 360 - 180);
+        writer.floating(random.unit() * 180 - 90);
+        writer.endArray();
+    }
+    writer.endArray();
+    writer.key("counts");
+    writer.startArray();
+    while (writer.getBuffer().size() < size) {
+        writer.integer(static_cast<long>(random.next() >> (random.below(64) | 1)) - 1000);
+    }
+    writer.endArray();
+    writer.endObject();
+    return { "numbers", writer.take(), 1, false };
+}
+
+/**
+ * Generates long strings with escape sequences and non-ASCII characters.
+ *
+ * @param size the approximate size in bytes
+ * @return the corpus
+ */
+static inline auto generateStrings(std::size_t size) -> Corpus {
+    static constexpr std::string_view escapes[] = { "\\u00e9", "\\u65e5", "\\ud83d\\ude80", "\\/", "\\r\\n" };
+
+    Random random;
+    std::string data = "[";
+    while (data.size() < size) {
+        if (data.size() > 1) {
+            data.push_back(',');
+        }
+        Writer writer;
+        std::string text;
+        appendWords(random, text, 20 + random.below(200));
+        writer.string(text);
+
+        // Inserts escape sequences the writer does not produce at word boundaries.
+        auto string = writer.take();
+        for (auto i = random.below(4); i > 0; --i) {
+            const auto position = string.find(' ', random.below(string.size()));
+            if (position != std::string::npos) {
+                string.insert(position + 1, escapes[random.below(std::size(escapes))]);
+            }
+        }
+        data.append(string);
+    }
+    data.push_back(']');
+    return { "strings", std::move(data), 1, false };
+}
+
+/**
+ * Writes a deeply nested value.
+ *
+ * @param random the random number generator
+ * @param writer the writer
+ * @param depth the remaining nesting depth
+ */
+static inline void writeNested(Random& random, Writer& writer, std::size_t depth) {
+    if (depth == 0) {
+        writer.integer(static_cast<long>(random.below(1000)));
+        return;
+    }
+    const auto width = depth % 8 == 0 ? 2 : 1;
+    if (random.chance(0.5)) {
+        writer.startArray();
+        for (int i = 0; i < width; ++i) {
+            writeNested(random, writer, depth - 1);
+        }
+        writer.endArray();
+    } else {
+        writer.startObject();
+        for (int i = 0; i < width; ++i) {
+            writer.key(i == 0 ? "child" : "sibling");
+            writeNested(random, writer, depth - 1);
+        }
+        writer.endObject();
+    }
+}
+
+/**
+ * Generates deeply nested arrays and objects.
+ *
+ * @param size the approximate size in bytes
+ * @return the corpus
+ */
+static inline auto generateNested(std::size_t size) -> Corpus {
+    Random random;
+    Writer writer;
+    writer.startArray();
+    while (writer.getBuffer().size() < size) {
+        writeNested(random, writer, 40);
+    }
+    writer.endArray();
+    return { "nested", writer.take(), 1, false };
+}
+
+auto generateCorpora(std::size_t scale) -> std::vector<Corpus> {
+    const auto size = baseSize * scale;
+
+    std::vector<Corpus> corpora;
+    corpora.push_back(generateTwitter(size, false));
+    corpora.push_back(generateTwitter(size, true));
+    corpora.push_back(generateNumbers(size));
+    corpora.push_back(generateStrings(size));
+    corpora.push_back(generateNested(size));
+    corpora.push_back(generateDelimited(size));
+    return corpora;
+}
+}
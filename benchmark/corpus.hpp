@@ -0,0 +1,56 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_benchmark_corpus_hpp
+#define SimpleJSON_benchmark_corpus_hpp
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace simple_json::benchmark {
+/**
+ * A generated benchmark input.
+ */
+struct Corpus {
+    /** The name of the corpus.                                           */
+    std::string name;
+    /** The JSON data.                                                    */
+    std::string data;
+    /** The amount of documents in the data.                              */
+    std::size_t documents;
+    /** Whether the data consists of newline delimited documents (NDJSON). */
+    bool delimited;
+};
+
+/**
+ * @brief Generates the benchmark corpora.
+ *
+ * The corpora are generated from a fixed seed, the same scale therefore
+ * always yields the same data:
+ *  - @c twitter : an array of tweet-like records, minified
+ *  - @c twitter-pretty : the same records, pretty-printed
+ *  - @c numbers : arrays of coordinates and integers
+ *  - @c strings : long strings with escape sequences and non-ASCII characters
+ *  - @c nested : deeply nested arrays and objects
+ *  - @c ndjson : the tweet-like records, one per line
+ *
+ * @param scale the size factor, each corpus has about @c scale times 4 MB
+ * @return the generated corpora
+ */
+auto generateCorpora(std::size_t scale) -> std::vector<Corpus>;
+}
+
+#endif /* SimpleJSON_benchmark_corpus_hpp */
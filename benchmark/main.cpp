@@ -0,0 +1,431 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "allocations.hpp"
+#include "corpus.hpp"
+
+namespace simple_json::benchmark {
+using Clock = std::chrono::steady_clock;
+
+/**
+ * The measurements of a corpus.
+ */
+struct Result {
+    /** The name of the corpus.                                     */
+    std::string corpus;
+    /** The size of the corpus in bytes.                            */
+    std::size_t bytes;
+    /** The amount of documents in the corpus.                      */
+    std::size_t documents;
+    /** The amount of measured iterations.                          */
+    std::size_t iterations;
+    /** The median time of the parsing in seconds.                  */
+    double parseSeconds;
+    /** The median time of accessing every value in seconds.        */
+    double accessSeconds;
+    /** The median time of the destruction of the trees in seconds. */
+    double destroySeconds;
+    /** The amount of allocations of one parse.                     */
+    std::size_t allocations;
+    /** The amount of bytes allocated by one parse.                 */
+    std::size_t allocated;
+    /** The peak amount of allocated bytes during one parse.        */
+    std::size_t peak;
+    /** The median time of the parsing into compact values.         */
+    double compactSeconds;
+    /** The amount of allocations of one compact parse.             */
+    std::size_t compactAllocations;
+    /** The peak amount of allocated bytes of one compact parse.    */
+    std::size_t compactPeak;
+};
+
+/**
+ * The options of the benchmark.
+ */
+struct Options {
+    /** The size factor of the corpora.                            */
+    std::size_t scale = 1;
+    /** The minimum measuring time per corpus in seconds.          */
+    double minimumTime = 1;
+    /** Whether to print the results as JSON.                      */
+    bool json = false;
+    /** The directory to write the corpora to, empty to not write. */
+    std::string corpusDirectory;
+    /** The names of the corpora to measure, empty for all.        */
+    std::vector<std::string> names;
+};
+
+/**
+ * Returns the median of the given durations.
+ *
+ * @param durations the durations
+ * @return the median
+ */
+static inline auto median(std::vector<double> durations) -> double {
+    std::sort(durations.begin(), durations.end());
+    return durations[durations.size() / 2];
+}
+
+/**
+ * Parses the given corpus.
+ *
+ * @param corpus the corpus
+ * @return the parsed documents
+ */
+static inline auto parseCorpus(const Corpus& corpus) -> std::vector<Value> {
+    std::vector<Value> documents;
+    if (corpus.delimited) {
+        documents.reserve(corpus.documents);
+        auto stream = parseMany(corpus.data);
+        Value value;
+        while (stream.next(value)) {
+            documents.push_back(std::move(value));
+            value = Value();
+        }
+    } else {
+        documents.push_back(parse(std::string_view(corpus.data)));
+    }
+    return documents;
+}
+
+/**
+ * Parses the given corpus into compact values.
+ *
+ * @param corpus the corpus
+ * @return the parsed documents
+ */
+static inline auto parseCompactCorpus(const Corpus& corpus) -> std::vector<CompactValue> {
+    std::vector<CompactValue> documents;
+    if (corpus.delimited) {
+        documents.reserve(corpus.documents);
+        auto data = std::string_view(corpus.data);
+        while (!data.empty()) {
+            const auto end = std::min(data.find('\n'), data.size());
+            if (end > 0) {
+                documents.push_back(parseCompact(data.substr(0, end)));
+            }
+            data.remove_prefix(std::min(end + 1, data.size()));
+        }
+    } else {
+        documents.push_back(parseCompact(std::string_view(corpus.data)));
+    }
+    return documents;
+}
+
+/**
+ * Accesses every value of the given value using the accessors, including
+ * a lookup of every key.
+ *
+ * @param value the value
+ * @return a checksum of the accessed values
+ */
+static auto access(const Value& value) -> std::size_t {
+    switch (value.type) {
+        case ValueType::Int:    return static_cast<std::size_t>(value.as<ValueType::Int>());
+        case ValueType::UInt:   return value.as<ValueType::UInt>();
+        case ValueType::Double: return static_cast<std::size_t>(static_cast<long>(value.as<ValueType::Double>()));
+        case ValueType::String: return value.asStringView().size();
+        case ValueType::Bool:   return value.as<ValueType::Bool>() ? 1 : 0;
+        case ValueType::Null:   return 0;
+
+        case ValueType::Array: {
+            std::size_t checksum = 0;
+            for (const auto& element : value.as<ValueType::Array>()) {
+                checksum += access(element);
+            }
+            return checksum;
+        }
+
+        case ValueType::Object: {
+            const auto& members = value.as<ValueType::Object>();
+            std::size_t checksum = 0;
+            for (const auto& [name, member] : members) {
+                checksum += access(members.at(name)) + name.size();
+            }
+            return checksum;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Measures the given corpus.
+ *
+ * @param corpus the corpus
+ * @param minimumTime the minimum measuring time in seconds
+ * @return the measurements
+ */
+static inline auto measure(const Corpus& corpus, double minimumTime) -> Result {
+    Result result { corpus.name, corpus.data.size(), corpus.documents, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    // Warms up and counts the allocations of one parse.
+    {
+        const auto before = allocations;
+        allocations.peak = allocations.current;
+        auto documents = parseCorpus(corpus);
+        result.allocations = allocations.count - before.count;
+        result.allocated   = allocations.bytes - before.bytes;
+        result.peak        = allocations.peak - before.current;
+    }
+    {
+        const auto before = allocations;
+        allocations.peak = allocations.current;
+        auto documents = parseCompactCorpus(corpus);
+        result.compactAllocations = allocations.count - before.count;
+        result.compactPeak        = allocations.peak - before.current;
+    }
+
+    std::vector<double> parsing, accessing, destroying;
+    std::size_t checksum = 0;
+    const auto start = Clock::now();
+    do {
+        const auto begin = Clock::now();
+        auto documents = parseCorpus(corpus);
+        const auto parsed = Clock::now();
+        for (const auto& document : documents) {
+            checksum += access(document);
+        }
+        const auto accessed = Clock::now();
+        documents = std::vector<Value>();
+        const auto destroyed = Clock::now();
+
+        parsing.push_back(std::chrono::duration<double>(parsed - begin).count());
+        accessing.push_back(std::chrono::duration<double>(accessed - parsed).count());
+        destroying.push_back(std::chrono::duration<double>(destroyed - accessed).count());
+    } while (parsing.size() < 3 || std::chrono::duration<double>(Clock::now() - start).count() < minimumTime);
+
+    std::vector<double> compacting;
+    const auto compactStart = Clock::now();
+    do {
+        const auto begin = Clock::now();
+        auto documents = parseCompactCorpus(corpus);
+        compacting.push_back(std::chrono::duration<double>(Clock::now() - begin).count());
+    } while (compacting.size() < 3 || std::chrono::duration<double>(Clock::now() - compactStart).count() < minimumTime / 2);
+
+    // Keeps the accesses from being optimized away.
+    if (checksum == 42) {
+        std::fputc('\0', stderr);
+    }
+    result.iterations     = parsing.size();
+    result.parseSeconds   = median(parsing);
+    result.accessSeconds  = median(accessing);
+    result.destroySeconds = median(destroying);
+    result.compactSeconds = median(compacting);
+    return result;
+}
+
+/**
+ * Prints the given results as a table.
+ *
+ * @param results the results
+ */
+static inline void printTable(const std::vector<Result>& results) {
+    std::printf("%-16s %9s %9s %12s %10s %10s %10s %11s %11s %12s %15s\n", "corpus", "MB", "MB/s", "docs/s",
+                "parse ms", "access ms", "destroy ms", "allocations", "peak MB", "compact MB/s", "compact peak MB");
+    for (const auto& result : results) {
+        std::printf("%-16s %9.2f %9.1f %12.0f %10.2f %10.2f %10.2f %11zu %11.2f %12.1f %15.2f\n", result.corpus.c_str(),
+                    static_cast<double>(result.bytes) / 1e6,
+                    static_cast<double>(result.bytes) / result.parseSeconds / 1e6,
+                    static_cast<double>(result.documents) / result.parseSeconds,
+                    result.parseSeconds * 1e3, result.accessSeconds * 1e3, result.destroySeconds * 1e3,
+                    result.allocations, static_cast<double>(result.peak) / 1e6,
+                    static_cast<double>(result.bytes) / result.compactSeconds / 1e6,
+                    static_cast<double>(result.compactPeak) / 1e6);
+    }
+}
+
+/**
+ * Prints the given results as JSON.
+ *
+ * @param results the results
+ * @param options the options of the benchmark
+ */
+static inline void printJSON(const std::vector<Result>& results, const Options& options) {
+    Writer writer(std::cout, { true });
+    writer.startObject();
+    writer.key("scale");
+    writer.unsignedInteger(options.scale);
+    writer.key("results");
+    writer.startArray();
+    for (const auto& result : results) {
+        writer.startObject();
+        writer.key("corpus");
+        writer.string(result.corpus);
+        writer.key("bytes");
+        writer.unsignedInteger(result.bytes);
+        writer.key("documents");
+        writer.unsignedInteger(result.documents);
+        writer.key("iterations");
+        writer.unsignedInteger(result.iterations);
+        writer.key("mb_per_second");
+        writer.floating(static_cast<double>(result.bytes) / result.parseSeconds / 1e6);
+        writer.key("documents_per_second");
+        writer.floating(static_cast<double>(result.documents) / result.parseSeconds);
+        writer.key("parse_seconds");
+        writer.floating(result.parseSeconds);
+        writer.key("access_seconds");
+        writer.floating(result.accessSeconds);
+        writer.key("destroy_seconds");
+        writer.floating(result.destroySeconds);
+        writer.key("allocations");
+        writer.unsignedInteger(result.allocations);
+        writer.key("allocated_bytes");
+        writer.unsignedInteger(result.allocated);
+        writer.key("peak_bytes");
+        writer.unsignedInteger(result.peak);
+        writer.key("compact_mb_per_second");
+        writer.floating(static_cast<double>(result.bytes) / result.compactSeconds / 1e6);
+        writer.key("compact_allocations");
+        writer.unsignedInteger(result.compactAllocations);
+        writer.key("compact_peak_bytes");
+        writer.unsignedInteger(result.compactPeak);
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+    writer.flush();
+    std::cout << std::endl;
+}
+
+/**
+ * Compares the results of two runs and prints the relative differences.
+ *
+ * @param before the file containing the earlier results
+ * @param after the file containing the later results
+ * @return whether both files could be read
+ */
+static inline auto compare(const std::string& before, const std::string& after) -> bool {
+    static constexpr const char* metrics[] = {
+        "mb_per_second", "parse_seconds", "access_seconds", "destroy_seconds", "allocations", "peak_bytes",
+        "compact_peak_bytes"
+    };
+
+    auto earlierStream = std::ifstream(before);
+    auto laterStream   = std::ifstream(after);
+    if (!earlierStream || !laterStream) {
+        std::cerr << "Could not open the results to compare" << std::endl;
+        return false;
+    }
+    const auto earlier = Object(parse<ValueType::Object>(earlierStream)).getBang<ValueType::Array>("results");
+    const auto later   = Object(parse<ValueType::Object>(laterStream)).getBang<ValueType::Array>("results");
+
+    std::printf("%-16s", "corpus");
+    for (const auto metric : metrics) {
+        std::printf(" %16s", metric);
+    }
+    std::printf("\n");
+    for (const auto& laterValue : later) {
+        const Object laterResult = laterValue;
+        const auto name = laterResult.getBang<ValueType::String>("corpus");
+        const auto match = std::find_if(earlier.begin(), earlier.end(), [&name](const Value& value) {
+            return Object(value).getBang<ValueType::String>("corpus") == name;
+        });
+        if (match == earlier.end()) {
+            continue;
+        }
+        const Object earlierResult = *match;
+        std::printf("%-16s", name.c_str());
+        for (const auto metric : metrics) {
+            if (earlierResult.content.count(metric) == 0 || laterResult.content.count(metric) == 0) {
+                std::printf(" %16s", "-");
+                continue;
+            }
+            const auto toDouble = [metric](const Object& object) {
+                const auto& value = object.content.at(metric);
+                switch (value.type) {
+                    case ValueType::Int:  return static_cast<double>(value.as<ValueType::Int>());
+                    case ValueType::UInt: return static_cast<double>(value.as<ValueType::UInt>());
+                    default:              return value.as<ValueType::Double>();
+                }
+            };
+            const auto from = toDouble(earlierResult);
+            std::printf(" %+15.1f%%", from == 0 ? 0 : (toDouble(laterResult) - from) / from * 100);
+        }
+        std::printf("\n");
+    }
+    return true;
+}
+
+/**
+ * Prints the usage of the benchmark.
+ *
+ * @param program the name of the program
+ */
+static inline void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [--json] [--scale <n>] [--time <seconds>] [--write-corpus <directory>] "
+                 "[corpus...]" << std::endl
+              << "       " << program << " --compare <before.json> <after.json>" << std::endl;
+}
+}
+
+int main(int argc, char** argv) {
+    using namespace simple_json::benchmark;
+
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const auto argument = std::string_view(argv[i]);
+        const auto hasValue = i + 1 < argc;
+        if (argument == "--json") {
+            options.json = true;
+        } else if (argument == "--scale" && hasValue) {
+            options.scale = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if (argument == "--time" && hasValue) {
+            options.minimumTime = std::strtod(argv[++i], nullptr);
+        } else if (argument == "--write-corpus" && hasValue) {
+            options.corpusDirectory = argv[++i];
+        } else if (argument == "--compare" && i + 2 < argc) {
+            return compare(argv[i + 1], argv[i + 2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+        } else if (argument.substr(0, 2) == "--") {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        } else {
+            options.names.emplace_back(argument);
+        }
+    }
+
+    std::vector<Result> results;
+    for (const auto& corpus : generateCorpora(options.scale)) {
+        if (!options.names.empty()
+            && std::find(options.names.begin(), options.names.end(), corpus.name) == options.names.end()) {
+            continue;
+        }
+        if (!options.corpusDirectory.empty()) {
+            const auto extension = corpus.delimited ? ".ndjson" : ".json";
+            const auto path = options.corpusDirectory + "/" + corpus.name + extension;
+            if (!(std::ofstream(path, std::ios::binary) << corpus.data)) {
+                std::cerr << "Could not write " << path << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        results.push_back(measure(corpus, options.minimumTime));
+    }
+    if (options.json) {
+        printJSON(results, options);
+    } else {
+        printTable(results);
+    }
+}
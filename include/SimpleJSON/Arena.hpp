@@ -0,0 +1,195 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Arena_hpp
+#define SimpleJSON_Arena_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace simple_json {
+/**
+ * @brief A monotonic memory arena.
+ *
+ * Memory is handed out by bumping a pointer into chunks of growing size.
+ * Single allocations are never freed; all chunks are released at once when
+ * the arena is destroyed. The chunks are allocated using @c allocateOnHeap() .
+ */
+class Arena {
+    /**
+     * The header of a chunk of memory, directly followed by its usable memory.
+     */
+    struct Chunk {
+        /** The previously allocated chunk. */
+        Chunk* previous;
+    };
+
+    /** The most recently allocated chunk.           */
+    Chunk* chunks = nullptr;
+    /** The next free byte in the current chunk.     */
+    char* current = nullptr;
+    /** The end of the current chunk.                */
+    char* end     = nullptr;
+    /** The size of the next chunk to be allocated.  */
+    std::size_t nextSize;
+
+    /**
+     * Allocates a new chunk that can hold at least the given amount of bytes.
+     *
+     * @param size the amount of bytes to be allocated
+     * @param alignment the alignment of the allocation
+     * @return the allocated memory
+     */
+    auto grow(std::size_t size, std::size_t alignment) -> void*;
+
+public:
+    /**
+     * Constructs an empty arena.
+     *
+     * @param initialSize the size of the first chunk to be allocated
+     */
+    inline explicit Arena(std::size_t initialSize = 4096): nextSize(initialSize) {}
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+    inline ~Arena() {
+        release();
+    }
+
+    /**
+     * Allocates the given amount of bytes.
+     *
+     * @param size the amount of bytes to be allocated
+     * @param alignment the alignment of the allocation
+     * @return the allocated memory
+     */
+    inline auto allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) -> void* {
+        const auto address = (reinterpret_cast<std::uintptr_t>(current) + alignment - 1) & ~(alignment - 1);
+        if (current != nullptr && address + size <= reinterpret_cast<std::uintptr_t>(end)) {
+            current = reinterpret_cast<char*>(address + size);
+            return reinterpret_cast<void*>(address);
+        }
+        return grow(size, alignment);
+    }
+
+    /**
+     * Releases all memory allocated by this arena.
+     */
+    void release();
+};
+
+/**
+ * @brief Allocates the given amount of bytes on the heap.
+ *
+ * The allocations are counted for the parse statistics if the library is
+ * compiled with @c SIMPLE_JSON_STATS . Since the function is not inline, the
+ * code using the library does not depend on the macro.
+ *
+ * @param size the amount of bytes to be allocated
+ * @return the allocated memory
+ */
+auto allocateOnHeap(std::size_t size) -> void*;
+
+/**
+ * @brief An allocator allocating from an @c Arena or from the heap.
+ *
+ * A default constructed allocator uses the heap. Copies of containers always
+ * use the heap, so they can outlive the arena of the original.
+ *
+ * @tparam T the type of the allocated objects
+ */
+template<typename T>
+class Allocator {
+    template<typename U>
+    friend class Allocator;
+
+    /** The arena to allocate from, @c nullptr for the heap. */
+    Arena* arena = nullptr;
+
+public:
+    using value_type = T;
+
+    Allocator() = default;
+
+    /**
+     * Constructs an allocator allocating from the given arena.
+     *
+     * @param arena the arena to allocate from
+     */
+    constexpr inline Allocator(Arena* arena) noexcept: arena(arena) {}
+
+    template<typename U>
+    constexpr inline Allocator(const Allocator<U>& other) noexcept: arena(other.arena) {}
+
+    /**
+     * Allocates memory for the given amount of objects.
+     *
+     * @param n the amount of objects
+     * @return the allocated memory
+     */
+    inline auto allocate(std::size_t n) -> T* {
+        if (arena != nullptr) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(allocateOnHeap(n * sizeof(T)));
+    }
+
+    /**
+     * Deallocates the given memory. Memory of an arena is only released
+     * together with the arena.
+     *
+     * @param pointer the memory to deallocate
+     * @param n the amount of objects
+     */
+    inline void deallocate(T* pointer, std::size_t n) noexcept {
+        (void) n;
+        if (arena == nullptr) {
+            ::operator delete(pointer);
+        }
+    }
+
+    /**
+     * Returns the allocator used for copies of containers: the heap.
+     *
+     * @return a heap allocator
+     */
+    constexpr inline auto select_on_container_copy_construction() const -> Allocator {
+        return Allocator();
+    }
+
+    /**
+     * Returns the arena this allocator allocates from.
+     *
+     * @return the arena or @c nullptr if the heap is used
+     */
+    constexpr inline auto getArena() const -> Arena* {
+        return arena;
+    }
+
+    template<typename U>
+    constexpr inline auto operator==(const Allocator<U>& other) const -> bool {
+        return arena == other.arena;
+    }
+
+    template<typename U>
+    constexpr inline auto operator!=(const Allocator<U>& other) const -> bool {
+        return arena != other.arena;
+    }
+};
+}
+
+#endif /* SimpleJSON_Arena_hpp */
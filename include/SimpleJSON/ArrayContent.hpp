@@ -0,0 +1,407 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_ArrayContent_hpp
+#define SimpleJSON_ArrayContent_hpp
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Shared.hpp"
+
+namespace simple_json {
+/**
+ * @brief A sequence of values offering the interface of a @c std::vector .
+ *
+ * Copies share the elements in constant time; the elements are cloned when a
+ * shared sequence is modified through a non-const member function. Since the
+ * elements are copied the same way, modifying a nested value only clones the
+ * containers on the path to it. Shared sequences may be read concurrently from
+ * multiple threads.
+ *
+ * Once a mutable reference or iterator has been handed out, copies copy the
+ * elements instead of sharing them, until the sequence is cleared.
+ *
+ * Unlike the ones of a @c std::vector , @c begin() and @c end() only return
+ * read-only iterators, also for a non-const sequence, so iterating never
+ * clones the elements. Mutable iterators are returned by @c mutableBegin()
+ * and @c mutableEnd() .
+ *
+ * @tparam T the type of the elements
+ * @tparam Allocator the allocator to be used
+ */
+template<typename T, typename Allocator>
+class BasicArrayContent {
+    using Vector = std::vector<T, Allocator>;
+
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = typename Vector::iterator;
+    using const_iterator  = typename Vector::const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    /** The possibly shared elements. */
+    Shared<Vector, Allocator> content;
+
+    /**
+     * Returns the elements for writing, cloning them if they are shared.
+     *
+     * @return the elements
+     */
+    inline auto elements() -> Vector& {
+        return content.mutate();
+    }
+
+    /**
+     * Returns the elements for handing out mutable references to them,
+     * cloning them if they are shared. They are not shared anymore afterwards.
+     *
+     * @return the elements
+     */
+    inline auto exposedElements() -> Vector& {
+        return content.expose();
+    }
+
+public:
+    BasicArrayContent() = default;
+
+    /**
+     * Constructs an empty sequence using the given allocator.
+     *
+     * @param allocator the allocator
+     */
+    inline explicit BasicArrayContent(const allocator_type& allocator): content(allocator) {}
+
+    /**
+     * Constructs a sequence from the given elements.
+     *
+     * @param elements the elements
+     */
+    inline BasicArrayContent(std::initializer_list<T> elements) {
+        this->elements().assign(elements);
+    }
+
+    /**
+     * Constructs a sequence taking over the elements of the given vector.
+     *
+     * @param elements the elements
+     */
+    inline explicit BasicArrayContent(std::vector<T, Allocator>&& elements): content(elements.get_allocator()) {
+        this->elements() = std::move(elements);
+    }
+
+    /**
+     * @brief Returns a mutable iterator to the first element.
+     *
+     * Clones the elements if they are shared with copies of this sequence.
+     *
+     * @return an iterator to the first element
+     */
+    inline auto mutableBegin() -> iterator {
+        return content.get() == nullptr ? iterator() : exposedElements().begin();
+    }
+
+    /**
+     * @brief Returns the mutable end iterator.
+     *
+     * Clones the elements if they are shared with copies of this sequence.
+     *
+     * @return the end iterator
+     */
+    inline auto mutableEnd() -> iterator {
+        return content.get() == nullptr ? iterator() : exposedElements().end();
+    }
+
+    inline auto begin() const -> const_iterator { return cbegin(); }
+    inline auto end()   const -> const_iterator { return cend();   }
+
+    inline auto cbegin() const -> const_iterator {
+        return content.get() == nullptr ? const_iterator() : content.get()->cbegin();
+    }
+
+    inline auto cend() const -> const_iterator {
+        return content.get() == nullptr ? const_iterator() : content.get()->cend();
+    }
+
+    inline auto rbegin()  const -> const_reverse_iterator { return crbegin();                         }
+    inline auto rend()    const -> const_reverse_iterator { return crend();                           }
+    inline auto crbegin() const -> const_reverse_iterator { return const_reverse_iterator(cend());   }
+    inline auto crend()   const -> const_reverse_iterator { return const_reverse_iterator(cbegin()); }
+
+    inline auto mutableRbegin() -> reverse_iterator { return reverse_iterator(mutableEnd());   }
+    inline auto mutableRend()   -> reverse_iterator { return reverse_iterator(mutableBegin()); }
+
+    /**
+     * Returns the underlying array of the elements.
+     *
+     * @return the elements or @c nullptr if this sequence has never held any
+     */
+    inline auto data() const -> const_pointer {
+        return content.get() == nullptr ? nullptr : content.get()->data();
+    }
+
+    /**
+     * @brief Returns the underlying array of the elements for writing.
+     *
+     * Clones the elements if they are shared with copies of this sequence.
+     *
+     * @return the elements or @c nullptr if this sequence has never held any
+     */
+    inline auto data() -> pointer {
+        return content.get() == nullptr ? nullptr : exposedElements().data();
+    }
+
+    inline auto size() const -> size_type {
+        return content.get() == nullptr ? 0 : content.get()->size();
+    }
+
+    inline auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    inline auto capacity() const -> size_type {
+        return content.get() == nullptr ? 0 : content.get()->capacity();
+    }
+
+    inline auto operator[](size_type position) const -> const T& {
+        return (*content.get())[position];
+    }
+
+    inline auto operator[](size_type position) -> T& {
+        return exposedElements()[position];
+    }
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position of the element
+     * @return the element
+     * @throws std::out_of_range if the position is out of range
+     */
+    inline auto at(size_type position) const -> const T& {
+        if (position >= size()) {
+            throw std::out_of_range("simple_json::ArrayContent::at");
+        }
+        return (*this)[position];
+    }
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position of the element
+     * @return the element
+     * @throws std::out_of_range if the position is out of range
+     */
+    inline auto at(size_type position) -> T& {
+        if (position >= size()) {
+            throw std::out_of_range("simple_json::ArrayContent::at");
+        }
+        return (*this)[position];
+    }
+
+    inline auto front() const -> const T& { return content.get()->front();      }
+    inline auto back()  const -> const T& { return content.get()->back();       }
+    inline auto front()       -> T&       { return exposedElements().front(); }
+    inline auto back()        -> T&       { return exposedElements().back();  }
+
+    /**
+     * Reserves space for the given amount of elements.
+     *
+     * @param capacity the amount of elements
+     */
+    inline void reserve(size_type capacity) {
+        elements().reserve(capacity);
+    }
+
+    /**
+     * Resizes this sequence to the given amount of elements.
+     *
+     * @param count the amount of elements
+     */
+    inline void resize(size_type count) {
+        elements().resize(count);
+    }
+
+    /**
+     * Removes all elements. The capacity is kept unless the elements are
+     * shared with copies of this sequence.
+     */
+    inline void clear() {
+        if (content.isShared()) {
+            content = Shared<Vector, Allocator>(content.getAllocator());
+        } else if (content.get() != nullptr) {
+            elements().clear();
+            content.share();
+        }
+    }
+
+    inline void push_back(const T& value) {
+        elements().push_back(value);
+    }
+
+    inline void push_back(T&& value) {
+        elements().push_back(std::move(value));
+    }
+
+    template<typename... Args>
+    inline auto emplace_back(Args&&... args) -> T& {
+        return exposedElements().emplace_back(std::forward<Args>(args)...);
+    }
+
+    inline void pop_back() {
+        elements().pop_back();
+    }
+
+    /**
+     * Inserts the given element before the given position.
+     *
+     * @param position the position to insert before
+     * @param value the element to insert
+     * @return an iterator to the inserted element
+     */
+    template<typename V>
+    inline auto insert(const_iterator position, V&& value) -> iterator {
+        const auto offset = position - cbegin();
+        auto& mutableElements = exposedElements();
+        return mutableElements.insert(mutableElements.cbegin() + offset, std::forward<V>(value));
+    }
+
+    /**
+     * Inserts the given amount of copies of the given element before the given position.
+     *
+     * @param position the position to insert before
+     * @param count the amount of copies
+     * @param value the element to insert
+     * @return an iterator to the first inserted element
+     */
+    inline auto insert(const_iterator position, size_type count, const T& value) -> iterator {
+        const auto offset = position - cbegin();
+        auto& mutableElements = exposedElements();
+        return mutableElements.insert(mutableElements.cbegin() + offset, count, value);
+    }
+
+    /**
+     * Inserts the elements of the given range before the given position.
+     *
+     * @param position the position to insert before
+     * @param first the first element to insert
+     * @param last the end of the range to insert
+     * @return an iterator to the first inserted element
+     */
+    template<typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    inline auto insert(const_iterator position, InputIterator first, InputIterator last) -> iterator {
+        const auto offset = position - cbegin();
+        auto& mutableElements = exposedElements();
+        return mutableElements.insert(mutableElements.cbegin() + offset, first, last);
+    }
+
+    /**
+     * Inserts the given elements before the given position.
+     *
+     * @param position the position to insert before
+     * @param elements the elements to insert
+     * @return an iterator to the first inserted element
+     */
+    inline auto insert(const_iterator position, std::initializer_list<T> elements) -> iterator {
+        return insert(position, elements.begin(), elements.end());
+    }
+
+    /**
+     * Constructs an element in place before the given position.
+     *
+     * @param position the position to insert before
+     * @param args the arguments to construct the element with
+     * @return an iterator to the inserted element
+     */
+    template<typename... Args>
+    inline auto emplace(const_iterator position, Args&&... args) -> iterator {
+        const auto offset = position - cbegin();
+        auto& mutableElements = exposedElements();
+        return mutableElements.emplace(mutableElements.cbegin() + offset, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Removes the given element.
+     *
+     * @param position the element to remove
+     * @return an iterator to the element following the removed one
+     */
+    inline auto erase(const_iterator position) -> iterator {
+        return erase(position, position + 1);
+    }
+
+    /**
+     * Removes the given range of elements.
+     *
+     * @param first the first element to remove
+     * @param last the end of the range to remove
+     * @return an iterator to the element following the removed ones
+     */
+    inline auto erase(const_iterator first, const_iterator last) -> iterator {
+        const auto begin = cbegin();
+        auto& mutableElements = exposedElements();
+        return mutableElements.erase(mutableElements.cbegin() + (first - begin), mutableElements.cbegin() + (last - begin));
+    }
+
+    /**
+     * Returns whether the elements are shared with copies of this sequence.
+     *
+     * @return whether the elements are shared
+     */
+    inline auto isShared() const -> bool {
+        return content.isShared();
+    }
+
+    /**
+     * Returns the allocator of this sequence.
+     *
+     * @return the allocator
+     */
+    inline auto get_allocator() const -> allocator_type {
+        return content.getAllocator();
+    }
+
+    /**
+     * Compares the elements of the given sequences.
+     *
+     * @param lhs the one sequence
+     * @param rhs the other sequence
+     * @return whether the sequences contain equal elements in the same order
+     */
+    friend inline auto operator==(const BasicArrayContent& lhs, const BasicArrayContent& rhs) -> bool {
+        return lhs.content.get() == rhs.content.get() || std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    friend inline auto operator!=(const BasicArrayContent& lhs, const BasicArrayContent& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+}
+
+#endif /* SimpleJSON_ArrayContent_hpp */
@@ -0,0 +1,513 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Binding_hpp
+#define SimpleJSON_Binding_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Cursor.hpp"
+#include "Exception.hpp"
+#include "Value.hpp"
+
+/**
+ * Creates the field of the given type bound to the JSON key equal to the name
+ * of the given member.
+ *
+ * @param type the type containing the member
+ * @param member the name of the member
+ */
+#define SIMPLE_JSON_FIELD(type, member) ::simple_json::field(#member, &type::member)
+
+namespace simple_json {
+/**
+ * @brief A member of a type bound to a JSON key.
+ *
+ * @tparam T the type containing the member
+ * @tparam M the type of the member
+ */
+template<typename T, typename M>
+struct Field {
+    /** The JSON key of the member. */
+    std::string_view name;
+    /** The bound member.           */
+    M T::* member;
+};
+
+/**
+ * Creates the field binding the given member to the given JSON key.
+ *
+ * @param name the JSON key
+ * @param member the member
+ * @tparam T the type containing the member
+ * @tparam M the type of the member
+ * @return the field
+ */
+template<typename T, typename M>
+constexpr inline auto field(std::string_view name, M T::* member) -> Field<T, M> {
+    return { name, member };
+}
+
+/**
+ * Creates the list of the given fields.
+ *
+ * @param fields the fields
+ * @return the list of fields
+ */
+template<typename... Fields>
+constexpr inline auto fields(Fields... fields) {
+    return std::make_tuple(fields...);
+}
+
+/**
+ * @brief Binds a type to JSON objects.
+ *
+ * The binding is declared by specializing this structure with a static
+ * @c constexpr member @c fields , the list of the bound members:
+ * @code
+ * template<>
+ * struct simple_json::Binding<Point> {
+ *     static constexpr auto fields = simple_json::fields(SIMPLE_JSON_FIELD(Point, x),
+ *                                                        simple_json::field("y_coordinate", &Point::y));
+ * };
+ * @endcode
+ * Members can be of the types @c bool , integral and floating point types,
+ * @c std::string , @c Value , bound types and @c std::optional and
+ * @c std::vector of them.
+ *
+ * @tparam T the bound type
+ */
+template<typename T>
+struct Binding {};
+
+namespace binding {
+/**
+ * Returns whether the given type is bound.
+ *
+ * @tparam T the type
+ */
+template<typename T, typename = void>
+struct IsBound: std::false_type {};
+
+template<typename T>
+struct IsBound<T, std::void_t<decltype(Binding<T>::fields)>>: std::true_type {};
+
+/**
+ * Returns whether the given type is a @c std::optional .
+ *
+ * @tparam T the type
+ */
+template<typename T>
+struct IsOptional: std::false_type {};
+
+template<typename T>
+struct IsOptional<std::optional<T>>: std::true_type {};
+
+/**
+ * Returns whether the given type is a @c std::vector .
+ *
+ * @tparam T the type
+ */
+template<typename T>
+struct IsVector: std::false_type {};
+
+template<typename T, typename Allocator>
+struct IsVector<std::vector<T, Allocator>>: std::true_type {};
+
+/**
+ * Hashes the given key.
+ *
+ * @param key the key
+ * @param seed the seed of the hash
+ * @return the hash value, best distributed in its upper bits
+ */
+constexpr inline auto hashKey(std::string_view key, std::uint64_t seed) -> std::uint64_t {
+    auto hash = seed ^ key.size();
+    for (const auto character : key) {
+        hash = (hash ^ static_cast<unsigned char>(character)) * 0x100000001b3;
+    }
+    return hash * 0x9e3779b97f4a7c15;
+}
+
+/**
+ * Returns the amount of bits needed for the given amount of slots.
+ *
+ * @param slots the minimal amount of slots
+ * @return the amount of bits of a slot index
+ */
+constexpr inline auto bitsFor(std::size_t slots) -> int {
+    int toReturn = 2;
+    while ((std::size_t(1) << toReturn) < slots) {
+        ++toReturn;
+    }
+    return toReturn;
+}
+
+/**
+ * @brief A perfect hash table of the keys of a bound type.
+ *
+ * Maps every key to a distinct slot containing the index of its field.
+ *
+ * @tparam Count the amount of keys
+ */
+template<std::size_t Count>
+struct KeyTable {
+    /** The amount of bits of a slot index.                    */
+    static constexpr int bits = bitsFor(Count * 4);
+
+    /** The seed of the hash not mapping two keys to one slot. */
+    std::uint64_t seed = 0;
+    /** The index of the field plus one per slot, @c 0 if empty. */
+    std::array<std::uint16_t, std::size_t(1) << bits> slots {};
+
+    /**
+     * Returns the slot of the given key.
+     *
+     * @param key the key
+     * @return the index of the slot
+     */
+    constexpr inline auto slotOf(std::string_view key) const -> std::size_t {
+        return static_cast<std::size_t>(hashKey(key, seed) >> (64 - bits));
+    }
+};
+
+/**
+ * Returns whether the given keys are distinct.
+ *
+ * @param names the keys
+ * @tparam Count the amount of keys
+ * @return whether no key appears twice
+ */
+template<std::size_t Count>
+constexpr inline auto areUnique(const std::array<std::string_view, Count>& names) -> bool {
+    for (std::size_t i = 0; i < Count; ++i) {
+        for (std::size_t j = i + 1; j < Count; ++j) {
+            if (names[i] == names[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Searches a seed for which the hashes of the given keys do not collide.
+ *
+ * @param names the keys
+ * @tparam Count the amount of keys
+ * @return the hash table of the keys, its seed is @c 0 if none was found
+ */
+template<std::size_t Count>
+constexpr inline auto makeTable(const std::array<std::string_view, Count>& names) -> KeyTable<Count> {
+    KeyTable<Count> table;
+    for (table.seed = 1; table.seed < 4096; ++table.seed) {
+        table.slots = {};
+        std::size_t i = 0;
+        for (; i < Count; ++i) {
+            const auto slot = table.slotOf(names[i]);
+            if (table.slots[slot] != 0) {
+                break;
+            }
+            table.slots[slot] = static_cast<std::uint16_t>(i + 1);
+        }
+        if (i == Count) {
+            return table;
+        }
+    }
+    table.seed = 0;
+    return table;
+}
+
+/**
+ * The keys of a bound type.
+ *
+ * @tparam T the bound type
+ */
+template<typename T>
+struct Keys {
+    /** The amount of bound fields. */
+    static constexpr std::size_t count = std::tuple_size_v<std::decay_t<decltype(Binding<T>::fields)>>;
+
+    /**
+     * Collects the keys of the fields.
+     *
+     * @return the keys
+     */
+    template<std::size_t... I>
+    static constexpr inline auto collect(std::index_sequence<I...>) -> std::array<std::string_view, count> {
+        return { std::get<I>(Binding<T>::fields).name... };
+    }
+
+    /** The keys in the order of the fields. */
+    static constexpr auto names = collect(std::make_index_sequence<count>());
+    /** The hash table of the keys.           */
+    static constexpr auto table = makeTable(names);
+
+    static_assert(count < std::numeric_limits<std::uint16_t>::max(), "Too many bound fields");
+    static_assert(areUnique(names), "Bound keys must be unique");
+    static_assert(!areUnique(names) || table.seed != 0, "No collision-free hash found for the bound keys");
+
+    /**
+     * Returns the index of the field bound to the given key.
+     *
+     * @param key the key
+     * @return the index of the field or @c count if not bound
+     */
+    static inline auto find(std::string_view key) -> std::size_t {
+        const auto index = table.slots[table.slotOf(key)];
+        return index != 0 && names[index - 1] == key ? index - 1 : count;
+    }
+};
+
+/**
+ * Returns whether the given integer fits into the given integral type.
+ *
+ * @param number the integer
+ * @tparam M the integral type
+ * @return whether the integer is in the range of the type
+ */
+template<typename M>
+constexpr inline auto fits(const numbers::Number& number) -> bool {
+    using Limits = std::numeric_limits<M>;
+
+    if (number.type == ValueType::UInt) {
+        return number.unsignedInteger <= static_cast<std::make_unsigned_t<M>>(Limits::max());
+    }
+    if constexpr (std::is_signed_v<M>) {
+        return number.integer >= Limits::min() && number.integer <= Limits::max();
+    } else {
+        return number.integer >= 0 && static_cast<unsigned long>(number.integer) <= Limits::max();
+    }
+}
+
+template<typename M>
+inline void read(Cursor& in, M& target);
+
+/**
+ * Reads the value of the field with the given index.
+ *
+ * @param in the cursor
+ * @param object the object containing the field
+ * @param index the index of the field
+ * @tparam T the bound type
+ */
+template<typename T, std::size_t... I>
+inline void readField(Cursor& in, T& object, std::size_t index, std::index_sequence<I...>) {
+    (void) ((index == I && (read(in, object.*(std::get<I>(Binding<T>::fields).member)), true)) || ...);
+}
+
+/**
+ * Reads the JSON object at the current position of the given cursor into the
+ * given object. Members with unknown keys are skipped.
+ *
+ * @param in the cursor
+ * @param object the object to read into
+ * @tparam T the bound type
+ * @throws Exception if the parsing failed
+ */
+template<typename T>
+inline void readObject(Cursor& in, T& object) {
+    expectConsume(in, '{');
+    skipWhitespaces(in);
+    std::string buffer;
+    while (in.peek() != '}') {
+        bool escaped;
+        auto key = readRawString(in, escaped);
+        if (escaped) {
+            buffer = decode(in, key, escaped);
+            key    = buffer;
+        }
+        expectConsume(in, ':');
+        skipWhitespaces(in);
+        if (in.peek() == EOF) {
+            throw Exception('}', static_cast<char>(EOF), in.tellg());
+        }
+        const auto index = Keys<T>::find(key);
+        if (index == Keys<T>::count) {
+            skipValue(in);
+        } else {
+            readField(in, object, index, std::make_index_sequence<Keys<T>::count>());
+        }
+        skipWhitespaces(in);
+        if (in.peek() == ',') {
+            in.get();
+            skipWhitespaces(in);
+        }
+    }
+    expectConsume(in, '}');
+}
+
+/**
+ * Reads the JSON value at the current position of the given cursor into the
+ * given target.
+ *
+ * @param in the cursor
+ * @param target the target to read into
+ * @tparam M the type of the target
+ * @throws Exception if the parsing failed or the value does not match the type
+ */
+template<typename M>
+inline void read(Cursor& in, M& target) {
+    skipWhitespaces(in);
+    if constexpr (std::is_same_v<M, bool>) {
+        const auto start = in.tellg();
+        const auto first = in.peek();
+        const auto token = readToken(in);
+        if (token != "true" && token != "false") {
+            throw Exception(Error { ErrorCode::InvalidLiteral, start, '\0', static_cast<char>(first) });
+        }
+        target = token == "true";
+    } else if constexpr (std::is_integral_v<M>) {
+        const auto start  = in.tellg();
+        const auto number = readNumber(in);
+        if (number.type == ValueType::Double) {
+            throw Exception(ErrorCode::InvalidNumber, "Expected an integer", start);
+        }
+        if (!fits<M>(number)) {
+            throw Exception(ErrorCode::InvalidNumber, "Integer out of range", start);
+        }
+        target = number.type == ValueType::Int ? static_cast<M>(number.integer) : static_cast<M>(number.unsignedInteger);
+    } else if constexpr (std::is_floating_point_v<M>) {
+        const auto number = readNumber(in);
+        switch (number.type) {
+            case ValueType::Int:  target = static_cast<M>(number.integer);         break;
+            case ValueType::UInt: target = static_cast<M>(number.unsignedInteger); break;
+
+            default: target = static_cast<M>(number.floating); break;
+        }
+    } else if constexpr (std::is_same_v<M, std::string>) {
+        bool escaped;
+        const auto raw = readRawString(in, escaped);
+        target = decode(in, raw, escaped);
+    } else if constexpr (std::is_same_v<M, Value>) {
+        target = readValue(in);
+    } else if constexpr (IsOptional<M>::value) {
+        if (in.peek() == 'n') {
+            const auto start = in.tellg();
+            if (readToken(in) != "null") {
+                throw Exception(Error { ErrorCode::InvalidLiteral, start, '\0', 'n' });
+            }
+            target.reset();
+        } else {
+            read(in, target.emplace());
+        }
+    } else if constexpr (IsVector<M>::value) {
+        expectConsume(in, '[');
+        target.clear();
+        skipWhitespaces(in);
+        while (in.peek() != ']') {
+            if (in.peek() == EOF) {
+                throw Exception(']', static_cast<char>(EOF), in.tellg());
+            }
+            if constexpr (std::is_same_v<typename M::value_type, bool>) {
+                // The elements of a std::vector<bool> cannot be referenced.
+                bool element;
+                read(in, element);
+                target.push_back(element);
+            } else {
+                read(in, target.emplace_back());
+            }
+            skipWhitespaces(in);
+            if (in.peek() == ',') {
+                in.get();
+                skipWhitespaces(in);
+            }
+        }
+        expectConsume(in, ']');
+    } else {
+        static_assert(IsBound<M>::value, "Type is not bound, see simple_json::Binding");
+        readObject(in, target);
+    }
+}
+}
+
+/**
+ * @brief Parses the given buffer directly into the given type.
+ *
+ * The bound members of JSON objects are filled during the parsing, no
+ * @c Value is created for them. Members missing in the data keep their
+ * default values.
+ *
+ * Does not check for the integrity of the JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @tparam T the type to parse into, see @c Binding
+ * @return the parsed data
+ * @throws Exception if the parsing failed or the data does not match the type
+ */
+template<typename T>
+inline auto parse(std::string_view data) -> T {
+    T toReturn {};
+    auto in = Cursor(data);
+    binding::read(in, toReturn);
+    return toReturn;
+}
+
+/**
+ * @brief Parses the remaining content of the given input stream directly into
+ * the given type.
+ *
+ * The stream is read like by @c parse(std::istream&) , so the data following
+ * the value remains readable.
+ *
+ * @param stream the input stream to read the JSON data from
+ * @tparam T the type to parse into, see @c Binding
+ * @return the parsed data
+ * @throws Exception if the parsing failed or the data does not match the type
+ * @see parse(std::string_view)
+ */
+template<typename T>
+inline auto parse(std::istream& stream) -> T {
+    const auto start = static_cast<long long>(stream.tellg());
+    const auto buffer = readValueData(stream);
+
+    T toReturn {};
+    auto in = Cursor(buffer, start < 0 ? 0 : start);
+    binding::read(in, toReturn);
+    if (start >= 0) {
+        stream.clear();
+        stream.seekg(start + static_cast<long long>(in.consumed()));
+    }
+    return toReturn;
+}
+
+/**
+ * Parses the remaining content of the given input stream directly into the
+ * given type.
+ *
+ * @param stream the input stream to read the JSON data from
+ * @tparam T the type to parse into, see @c Binding
+ * @return the parsed data
+ * @throws Exception if the parsing failed or the data does not match the type
+ * @see parse(std::istream&)
+ */
+template<typename T>
+inline auto parse(std::istream&& stream) -> T {
+    return parse<T>(stream);
+}
+}
+
+#endif /* SimpleJSON_Binding_hpp */
@@ -0,0 +1,541 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Compact_hpp
+#define SimpleJSON_Compact_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "ValueType.hpp"
+
+namespace simple_json {
+class CompactArray;
+class CompactObject;
+
+/**
+ * @brief A JSON value in a compact representation of 16 bytes.
+ *
+ * Numbers, booleans and strings of up to 15 bytes are stored inline; longer
+ * strings, arrays and objects are stored out of line in a single allocation
+ * of exactly their size. The last byte contains the type, whether the string
+ * is stored inline and its length.
+ *
+ * Compact values are created by @c parseCompact and offer the same accessors
+ * as @c Value . Strings are returned as @c std::string_view , arrays as
+ * @c CompactArray and objects as @c CompactObject , which must not outlive
+ * the value. Copies are deep.
+ */
+class CompactValue {
+    friend class CompactBuilder;
+
+    /**
+     * The header of the out of line storage.
+     */
+    struct Block {
+        /** The amount of bytes of a string or of contained values. */
+        std::size_t size;
+    };
+
+    /** The bits of the tag containing the type.                      */
+    static constexpr std::uint8_t typeMask  = 0x07;
+    /** The bit of the tag marking a string stored inline.            */
+    static constexpr std::uint8_t inlineBit = 0x08;
+    /** The amount of bits the length of an inline string is shifted. */
+    static constexpr int lengthShift        = 4;
+
+    /**
+     * The payload of a value.
+     */
+    union Payload {
+        /** The value if the type is @c Int .             */
+        long integer;
+        /** The value if the type is @c UInt .            */
+        unsigned long unsignedInteger;
+        /** The value if the type is @c Double .          */
+        double floating;
+        /** The value if the type is @c Bool .            */
+        bool boolean;
+        /** The out of line storage, @c nullptr if empty. */
+        Block* block;
+    };
+
+    /** The payload of this value.                                    */
+    Payload payload {};
+    /** The characters of an inline string following the payload.   */
+    std::array<char, 7> characters {};
+    /** The type, the inline bit and the length of an inline string. */
+    std::uint8_t tag;
+
+    /**
+     * Returns the characters of a string stored inline, which span the
+     * payload and the following characters.
+     *
+     * @return the first character of the inline string
+     */
+    inline auto inlineCharacters() const -> const char* {
+        return reinterpret_cast<const char*>(this);
+    }
+
+    /**
+     * Returns whether this value owns out of line storage.
+     *
+     * @return whether the storage needs to be released
+     */
+    inline auto owns() const -> bool {
+        return (is(ValueType::String) && (tag & inlineBit) == 0) || is(ValueType::Array) || is(ValueType::Object);
+    }
+
+    /**
+     * Returns the values stored out of line.
+     *
+     * @return the first contained value
+     */
+    inline auto values() const -> CompactValue* {
+        return reinterpret_cast<CompactValue*>(payload.block + 1);
+    }
+
+    /**
+     * Returns the amount of values stored out of line.
+     *
+     * @return the amount of contained values
+     */
+    inline auto count() const -> std::size_t {
+        return payload.block == nullptr ? 0 : payload.block->size;
+    }
+
+    /**
+     * Releases the out of line storage of this value.
+     */
+    void release();
+
+    /**
+     * Copies the out of line storage of this value.
+     */
+    void clone();
+
+    /**
+     * Creates a string value.
+     *
+     * @param string the content of the string
+     * @return the created value
+     */
+    static auto makeString(std::string_view string) -> CompactValue;
+
+    /**
+     * Creates an array or object, moving the given values into it.
+     *
+     * @param type the type of the container
+     * @param values the values, alternating keys and values for an object
+     * @param count the amount of values
+     * @return the created value
+     */
+    static auto makeContainer(ValueType type, CompactValue* values, std::size_t count) -> CompactValue;
+
+public:
+    /**
+     * Constructs a @c null value.
+     */
+    constexpr inline CompactValue(): tag(static_cast<std::uint8_t>(ValueType::Null)) {}
+
+    inline CompactValue(const CompactValue& other): payload(other.payload), characters(other.characters), tag(other.tag) {
+        if (owns()) {
+            clone();
+        }
+    }
+
+    inline CompactValue(CompactValue&& other) noexcept: payload(other.payload), characters(other.characters), tag(other.tag) {
+        other.tag = static_cast<std::uint8_t>(ValueType::Null);
+    }
+
+    inline auto operator=(const CompactValue& other) -> CompactValue& {
+        // Copied first, so that this value is unchanged if the copying fails.
+        auto copy = CompactValue(other);
+        return *this = std::move(copy);
+    }
+
+    inline auto operator=(CompactValue&& other) noexcept -> CompactValue& {
+        if (this != &other) {
+            if (owns()) {
+                release();
+            }
+            payload    = other.payload;
+            characters = other.characters;
+            tag        = other.tag;
+            other.tag  = static_cast<std::uint8_t>(ValueType::Null);
+        }
+        return *this;
+    }
+
+    inline ~CompactValue() {
+        if (owns()) {
+            release();
+        }
+    }
+
+    /**
+     * Returns the type of this value.
+     *
+     * @return the type of the value
+     */
+    constexpr inline auto getType() const -> ValueType {
+        return static_cast<ValueType>(tag & typeMask);
+    }
+
+    /**
+     * Returns whether the contained type is equal to the given type.
+     *
+     * @param type the type to compare against
+     * @return whether the types match
+     */
+    constexpr inline auto is(ValueType type) const -> bool {
+        return getType() == type;
+    }
+
+    /**
+     * @brief Returns the contained value casted as the given type.
+     *
+     * Throws an exception if the contained value is not of the given type.
+     *
+     * @tparam T the value type to cast the contained value to
+     * @return the casted value
+     */
+    template<ValueType T>
+    inline auto as() const;
+};
+
+static_assert(sizeof(CompactValue) == 16, "CompactValue needs to be 16 bytes large");
+
+/**
+ * A view of a JSON array stored in a @c CompactValue .
+ */
+class CompactArray {
+    /** The first element.       */
+    const CompactValue* elements;
+    /** The amount of elements.  */
+    std::size_t count;
+
+public:
+    using value_type     = CompactValue;
+    using const_iterator = const CompactValue*;
+
+    /**
+     * Constructs a view of the given elements.
+     *
+     * @param elements the first element
+     * @param count the amount of elements
+     */
+    constexpr inline CompactArray(const CompactValue* elements, std::size_t count): elements(elements), count(count) {}
+
+    /**
+     * Returns the amount of elements.
+     *
+     * @return the amount of elements
+     */
+    constexpr inline auto size() const -> std::size_t {
+        return count;
+    }
+
+    /**
+     * Returns whether the array has no elements.
+     *
+     * @return whether the array is empty
+     */
+    constexpr inline auto empty() const -> bool {
+        return count == 0;
+    }
+
+    constexpr inline auto begin() const -> const_iterator { return elements;         }
+    constexpr inline auto end()   const -> const_iterator { return elements + count; }
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position of the element, must be smaller than the size
+     * @return the element
+     */
+    constexpr inline auto operator[](std::size_t position) const -> const CompactValue& {
+        return elements[position];
+    }
+
+    /**
+     * Returns the element at the given position.
+     *
+     * @param position the position of the element
+     * @return the element
+     * @throws std::out_of_range if the position is not smaller than the size
+     */
+    inline auto at(std::size_t position) const -> const CompactValue& {
+        if (position >= count) {
+            throw std::out_of_range("simple_json::CompactArray::at");
+        }
+        return elements[position];
+    }
+};
+
+/**
+ * @brief A view of a JSON object stored in a @c CompactValue .
+ *
+ * The members are kept in the order they appear in the parsed data; the keys
+ * are searched linearly. If a key appears multiple times, the last value is
+ * used.
+ */
+class CompactObject {
+    /** The first key, followed by its value and the other members. */
+    const CompactValue* members;
+    /** The amount of members.                                      */
+    std::size_t count;
+
+public:
+    /**
+     * An iterator over the members of an object, yielding pairs of the key
+     * and a reference to the value.
+     */
+    class Iterator {
+        /** The key of the current member. */
+        const CompactValue* current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<std::string_view, const CompactValue&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        /**
+         * Constructs an iterator pointing to the member with the given key.
+         *
+         * @param current the key of the member
+         */
+        constexpr inline explicit Iterator(const CompactValue* current): current(current) {}
+
+        inline auto operator*() const -> reference;
+
+        inline auto operator++() -> Iterator& {
+            current += 2;
+            return *this;
+        }
+
+        inline auto operator++(int) -> Iterator {
+            auto toReturn = *this;
+            ++*this;
+            return toReturn;
+        }
+
+        inline auto operator==(const Iterator& other) const -> bool { return current == other.current; }
+        inline auto operator!=(const Iterator& other) const -> bool { return current != other.current; }
+    };
+
+    /**
+     * Constructs a view of the given members.
+     *
+     * @param members the first key, followed by its value and the other members
+     * @param count the amount of members
+     */
+    constexpr inline CompactObject(const CompactValue* members, std::size_t count): members(members), count(count) {}
+
+    /**
+     * Returns the amount of members.
+     *
+     * @return the amount of members
+     */
+    constexpr inline auto size() const -> std::size_t {
+        return count;
+    }
+
+    /**
+     * Returns whether the object has no members.
+     *
+     * @return whether the object is empty
+     */
+    constexpr inline auto empty() const -> bool {
+        return count == 0;
+    }
+
+    inline auto begin() const -> Iterator { return Iterator(members);             }
+    inline auto end()   const -> Iterator { return Iterator(members + 2 * count); }
+
+    /**
+     * Searches the value for the given key.
+     *
+     * @param name the key to search
+     * @return the value or @c nullptr if not found
+     */
+    inline auto find(std::string_view name) const -> const CompactValue*;
+
+    /**
+     * @brief Gets the contained value for the given key.
+     *
+     * Throws an exception if the value is found but the type does not match
+     * the given type.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the value for the given key or @c std::nullopt if not found or @c null
+     */
+    template<ValueType T>
+    inline auto get(std::string_view name) const -> std::optional<decltype(std::declval<CompactValue>().as<T>())> {
+        if (const auto value = find(name); value != nullptr && !value->is(ValueType::Null)) {
+            return value->as<T>();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets the contained object for the given key.
+     *
+     * Throws an exception if the value is found but is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the object for the given key or @c std::nullopt if not found or @c null
+     */
+    inline auto getObject(std::string_view name) const -> std::optional<CompactObject>;
+
+    /**
+     * @brief Returns the value referred to by the given key.
+     *
+     * Throws an exception if the value is not found or the type does not match.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value
+     */
+    template<ValueType T>
+    inline auto getBang(std::string_view name) const {
+        if (const auto value = find(name)) {
+            return value->as<T>();
+        }
+        throw std::out_of_range("simple_json::CompactObject::getBang");
+    }
+
+    /**
+     * @brief Gets the object referred to by the given key.
+     *
+     * Throws an exception if the object is not found or is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the mapped object
+     */
+    inline auto getObjectBang(std::string_view name) const -> CompactObject;
+
+    /**
+     * @brief Gets the object referred to by the given key and casts it to the
+     * given type.
+     *
+     * Uses the functional style cast.
+     *
+     * @param name the key whose mapped object to get
+     * @tparam T the type to construct from the contained JSON object
+     * @return the mapped object casted to the given type or @c std::nullopt if not found or @c null
+     */
+    template<typename T>
+    inline auto maybeGetAs(std::string_view name) const -> std::optional<T> {
+        static_assert(std::is_constructible_v<T, CompactObject>,
+                      "Given type must be constructible from simple_json::CompactObject");
+
+        if (auto object = getObject(name)) {
+            return T(*object);
+        }
+        return std::nullopt;
+    }
+};
+
+template<ValueType T>
+inline auto CompactValue::as() const {
+    if (!is(T)) {
+        throw std::bad_variant_access();
+    }
+    if constexpr (T == ValueType::Int) {
+        return payload.integer;
+    } else if constexpr (T == ValueType::UInt) {
+        return payload.unsignedInteger;
+    } else if constexpr (T == ValueType::Double) {
+        return payload.floating;
+    } else if constexpr (T == ValueType::String) {
+        if ((tag & inlineBit) != 0) {
+            return std::string_view(inlineCharacters(), static_cast<std::size_t>(tag >> lengthShift));
+        }
+        return std::string_view(reinterpret_cast<const char*>(payload.block + 1), payload.block->size);
+    } else if constexpr (T == ValueType::Bool) {
+        return payload.boolean;
+    } else if constexpr (T == ValueType::Array) {
+        return CompactArray(values(), count());
+    } else if constexpr (T == ValueType::Object) {
+        return CompactObject(values(), count() / 2);
+    } else {
+        static_assert(T != ValueType::Null, "null values cannot be casted");
+    }
+}
+
+inline auto CompactObject::Iterator::operator*() const -> reference {
+    return { current->as<ValueType::String>(), current[1] };
+}
+
+inline auto CompactObject::find(std::string_view name) const -> const CompactValue* {
+    // Searches backwards, so the last occurrence of a key is found.
+    for (auto key = members + 2 * count; key != members;) {
+        key -= 2;
+        if (key->as<ValueType::String>() == name) {
+            return key + 1;
+        }
+    }
+    return nullptr;
+}
+
+inline auto CompactObject::getObject(std::string_view name) const -> std::optional<CompactObject> {
+    return get<ValueType::Object>(name);
+}
+
+inline auto CompactObject::getObjectBang(std::string_view name) const -> CompactObject {
+    return getBang<ValueType::Object>(name);
+}
+
+/**
+ * @brief Parses a JSON object or array from the given buffer into a compact value.
+ *
+ * Does not check for the integrity of JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @return the JSON data as @c CompactValue
+ * @throws Exception if the parsing failed
+ */
+auto parseCompact(std::string_view data) -> CompactValue;
+
+/**
+ * @brief Parses a JSON object or array from the given input stream into a
+ * compact value.
+ *
+ * Reads the stream like @c parse(std::istream&) , leaving the data following
+ * the value in the stream.
+ *
+ * Does not check for the integrity of JSON data.
+ *
+ * @param stream the input stream to read the JSON data from
+ * @return the JSON data as @c CompactValue
+ * @throws Exception if the parsing failed
+ */
+auto parseCompact(std::istream& stream) -> CompactValue;
+}
+
+#endif /* SimpleJSON_Compact_hpp */
@@ -0,0 +1,481 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Cursor_hpp
+#define SimpleJSON_Cursor_hpp
+
+#include <cstdio>
+#include <istream>
+#include <string>
+#include <string_view>
+
+#include "Exception.hpp"
+#include "Value.hpp"
+
+#include "numbers.hpp"
+#include "scanner.hpp"
+#include "strings.hpp"
+
+/**
+ * @file Cursor.hpp
+ *
+ * The reading primitives shared by the different parsers.
+ */
+
+namespace simple_json {
+/**
+ * @brief Represents the reading position inside of a contiguous buffer.
+ *
+ * Mirrors the subset of the @c std::istream interface used by the parser
+ * without the overhead of the stream buffer machinery.
+ */
+class Cursor {
+    /** The beginning of the buffer.                      */
+    const char* const begin;
+    /** The current reading position.                     */
+    const char* current;
+    /** The end of the buffer.                            */
+    const char* const end;
+    /** The position of the buffer in the original input. */
+    const long long offset;
+
+public:
+    /**
+     * Constructs a cursor for the given buffer.
+     *
+     * @param data the buffer to be read
+     * @param offset the position of the buffer in the original input
+     */
+    inline Cursor(std::string_view data, long long offset = 0):
+        begin(data.data()), current(data.data()), end(data.data() + data.size()), offset(offset) {}
+
+    /**
+     * Returns the character at the current position without consuming it.
+     *
+     * @return the current character or @c EOF if the end is reached
+     */
+    inline auto peek() const -> int {
+        return current < end ? static_cast<unsigned char>(*current) : EOF;
+    }
+
+    /**
+     * Consumes the character at the current position.
+     *
+     * @return the consumed character or @c EOF if the end is reached
+     */
+    inline auto get() -> int {
+        return current < end ? static_cast<unsigned char>(*current++) : EOF;
+    }
+
+    /**
+     * Returns the current reading position.
+     *
+     * @return the pointer to the current character
+     */
+    inline auto position() const -> const char* {
+        return current;
+    }
+
+    /**
+     * Returns the end of the buffer.
+     *
+     * @return the pointer behind the last character
+     */
+    inline auto last() const -> const char* {
+        return end;
+    }
+
+    /**
+     * Sets the current reading position.
+     *
+     * @param position the new position, must be inside the buffer
+     */
+    inline void seek(const char* position) {
+        current = position;
+    }
+
+    /**
+     * Consumes all JSON whitespaces at the current position.
+     */
+    inline void skipWhitespaces() {
+        current = scanner::skipWhitespaces(current, end);
+    }
+
+    /**
+     * Returns the number of consumed characters.
+     *
+     * @return the amount of consumed characters
+     */
+    inline auto consumed() const -> std::size_t {
+        return static_cast<std::size_t>(current - begin);
+    }
+
+    /**
+     * Returns the current position in the original input.
+     *
+     * @return the current position
+     */
+    inline auto tellg() const -> long long {
+        return offset + static_cast<long long>(consumed());
+    }
+};
+
+/**
+ * Skips the next whitespaces in the given cursor.
+ *
+ * @param in the cursor
+ */
+static inline void skipWhitespaces(Cursor& in) {
+    in.skipWhitespaces();
+}
+
+/**
+ * Creates the error for the unexpected character at the current position of
+ * the given cursor.
+ *
+ * @param in the cursor
+ * @param expected the expected character
+ * @return the error
+ */
+static inline auto unexpected(const Cursor& in, char expected) -> Error {
+    const auto got = in.peek();
+    return Error {
+        got == EOF ? ErrorCode::UnexpectedEnd : ErrorCode::UnexpectedCharacter, in.tellg(), expected, static_cast<char>(got)
+    };
+}
+
+/**
+ * Checks whether the next character in the given cursor is the given one.
+ *
+ * @param in the cursor
+ * @param expected the expected character
+ * @param error set to the error if the character is not the expected one
+ * @param skipWhite whether to skip remaining whitespaces before checking the character
+ * @return whether the character is the expected one
+ */
+static inline auto tryExpect(Cursor& in, char expected, Error& error, bool skipWhite = true) -> bool {
+    if (skipWhite) {
+        skipWhitespaces(in);
+    }
+    if (in.peek() != expected) {
+        error = unexpected(in, expected);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Expects the next character in the given cursor to be the given one.
+ *
+ * @param in the cursor
+ * @param expected the expected character
+ * @param skipWhite whether to skip remaining whitespaces before checking the character
+ * @throws Exception if the character is not the expected one
+ */
+static inline void expect(Cursor& in, char expected, bool skipWhite = true) {
+    Error error {};
+    if (!tryExpect(in, expected, error, skipWhite)) {
+        throw Exception(error);
+    }
+}
+
+/**
+ * @brief Checks whether the next character in the given cursor is the given
+ * one and consumes it if so.
+ *
+ * @param in the cursor
+ * @param expected the expected character
+ * @param error set to the error if the character is not the expected one
+ * @param skipWhite whether to skip remaining whitespaces before checking the character
+ * @return whether the character is the expected one
+ */
+static inline auto tryExpectConsume(Cursor& in, char expected, Error& error, bool skipWhite = true) -> bool {
+    if (!tryExpect(in, expected, error, skipWhite)) {
+        return false;
+    }
+    in.get();
+    return true;
+}
+
+/**
+ * @brief Expects the next character in the given cursor to be the given one.
+ *
+ * The expected character is consumed if found.
+ *
+ * @param in the cursor
+ * @param expected the expected character
+ * @param skipWhite whether to skip remaining whitespaces before checking the character
+ * @throws Exception if the character is not the expected one
+ */
+static inline void expectConsume(Cursor& in, char expected, bool skipWhite = true) {
+    expect(in, expected, skipWhite);
+    in.get();
+}
+
+/**
+ * Reads the raw content of a string surrounded by quotes.
+ *
+ * @param in the cursor to read from
+ * @param escaped set to whether the string contains escape sequences
+ * @param raw set to the raw content of the string
+ * @param error set to the error if no terminated string is found
+ * @return whether a string was read
+ */
+static inline auto tryReadRawString(Cursor& in, bool& escaped, std::string_view& raw, Error& error) -> bool {
+    if (!tryExpectConsume(in, '"', error)) {
+        return false;
+    }
+    const auto begin = in.position();
+    const auto end   = strings::findEnd(begin, in.last(), escaped);
+    in.seek(end);
+    if (end == in.last()) {
+        error = unexpected(in, '"');
+        return false;
+    }
+    in.get();
+    raw = std::string_view(begin, static_cast<std::size_t>(end - begin));
+    return true;
+}
+
+/**
+ * Reads the raw content of a string surrounded by quotes.
+ *
+ * @param in the cursor to read from
+ * @param escaped set to whether the string contains escape sequences
+ * @return the raw content of the string
+ * @throws Exception if no terminated string is found
+ */
+static inline auto readRawString(Cursor& in, bool& escaped) -> std::string_view {
+    std::string_view raw;
+    Error error {};
+    if (!tryReadRawString(in, escaped, raw, error)) {
+        throw Exception(error);
+    }
+    return raw;
+}
+
+/**
+ * Decodes the given raw string content.
+ *
+ * @param in the cursor the content was read from
+ * @param raw the raw string content
+ * @param escaped whether the content contains escape sequences
+ * @return the decoded string
+ * @throws Exception if an invalid escape sequence is found
+ */
+static inline auto decode(Cursor& in, std::string_view raw, bool escaped) -> std::string {
+    if (!escaped) {
+        return std::string(raw);
+    }
+    auto toReturn = std::string(raw.size(), '\0');
+    auto content = raw.data();
+    const auto last = strings::unescape(content, raw.data() + raw.size(), toReturn.data());
+    if (last == nullptr) {
+        in.seek(content);
+        throw Exception(Error { ErrorCode::InvalidEscape, in.tellg() });
+    }
+    toReturn.resize(static_cast<std::size_t>(last - toReturn.data()));
+    return toReturn;
+}
+
+/**
+ * Returns whether the given character terminates a primitive value.
+ *
+ * @param character the character
+ * @return whether the character is a whitespace, separator or closing bracket
+ */
+static inline auto isDelimiter(char character) -> bool {
+    return scanner::isWhitespace(character) || character == ',' || character == ']' || character == '}';
+}
+
+/**
+ * Reads the token of a primitive value: the characters up to the next
+ * whitespace, separator or closing bracket.
+ *
+ * @param in the cursor
+ * @return the read token
+ */
+static inline auto readToken(Cursor& in) -> std::string_view {
+    const auto begin = in.position();
+    auto current = begin;
+    while (current < in.last() && !isDelimiter(*current)) {
+        ++current;
+    }
+    in.seek(current);
+    return std::string_view(begin, static_cast<std::size_t>(current - begin));
+}
+
+/**
+ * Reads a number from the given cursor.
+ *
+ * @param in the cursor
+ * @param number set to the read number
+ * @param error set to the error if the number is malformed or too large
+ * @return whether a number was read
+ */
+static inline auto tryReadNumber(Cursor& in, numbers::Number& number, Error& error) -> bool {
+    const auto end = numbers::parse(in.position(), in.last(), number);
+    if (end == nullptr || (end < in.last() && !isDelimiter(*end))) {
+        error = Error { ErrorCode::InvalidNumber, in.tellg() };
+        return false;
+    }
+    in.seek(end);
+    return true;
+}
+
+/**
+ * Reads a number from the given cursor.
+ *
+ * @param in the cursor
+ * @return the read number
+ * @throws Exception if the number is malformed or too large
+ */
+static inline auto readNumber(Cursor& in) -> numbers::Number {
+    numbers::Number number;
+    Error error {};
+    if (!tryReadNumber(in, number, error)) {
+        throw Exception(error);
+    }
+    return number;
+}
+
+/**
+ * Reports the given number to the given handler.
+ *
+ * @param handler the handler
+ * @param number the number
+ * @tparam Handler the type of the handler
+ */
+template<typename Handler>
+static inline void reportNumber(Handler& handler, const numbers::Number& number) {
+    switch (number.type) {
+        case ValueType::Int:  handler.integer(number.integer);                 break;
+        case ValueType::UInt: handler.unsignedInteger(number.unsignedInteger); break;
+
+        default: handler.floating(number.floating); break;
+    }
+}
+
+/**
+ * Returns whether the given character starts a number.
+ *
+ * @param character the character
+ * @return whether the character is a minus or a digit
+ */
+static inline auto isNumberStart(int character) -> bool {
+    return character == '-' || (character >= '0' && character <= '9');
+}
+
+/**
+ * @brief Skips the JSON value at the current position of the given cursor.
+ *
+ * Strings are skipped using the string kernel, arrays and objects by matching
+ * their brackets. The skipped content is not validated otherwise.
+ *
+ * @param in the cursor
+ * @throws Exception if a string, array or object is not terminated
+ */
+static inline void skipValue(Cursor& in) {
+    skipWhitespaces(in);
+    const auto first = in.peek();
+    if (first == '"') {
+        bool escaped;
+        readRawString(in, escaped);
+        return;
+    }
+    if (first != '{' && first != '[') {
+        readToken(in);
+        return;
+    }
+    const auto last = in.last();
+    auto current = in.position() + 1;
+    std::size_t depth = 1;
+    while (depth > 0 && current < last) {
+        switch (*current++) {
+            case '"': {
+                bool escaped;
+                current = strings::findEnd(current, last, escaped);
+                if (current != last) {
+                    ++current;
+                }
+                break;
+            }
+
+            case '{':
+            case '[':
+                ++depth;
+                break;
+
+            case '}':
+            case ']':
+                --depth;
+                break;
+
+            default: break;
+        }
+    }
+    in.seek(current);
+    if (depth > 0) {
+        throw Exception(first == '{' ? '}' : ']', static_cast<char>(EOF), in.tellg());
+    }
+}
+
+/**
+ * Reads any JSON value from the given cursor into a @c Value owning its content.
+ *
+ * @param in the cursor
+ * @return the read value
+ * @throws Exception if the parsing failed
+ */
+auto readValue(Cursor& in) -> Value;
+
+/**
+ * Reads the remaining content of the given input stream.
+ *
+ * @param in the input stream
+ * @return the read content
+ */
+static inline auto readAll(std::istream& in) -> std::string {
+    std::string buffer;
+    auto buf = in.rdbuf();
+    if (buf == nullptr) {
+        return buffer;
+    }
+    char chunk[65536];
+    std::streamsize read;
+    while ((read = buf->sgetn(chunk, sizeof(chunk))) > 0) {
+        buffer.append(chunk, static_cast<std::size_t>(read));
+    }
+    return buffer;
+}
+
+/**
+ * @brief Reads the data of the value at the current position of the given
+ * input stream.
+ *
+ * The remaining content of seekable streams is read at once; they are
+ * positioned behind the value by the caller. Other streams, such as pipes
+ * and sockets, are read up to the end of the value, so the data following
+ * it remains readable: the available characters are taken out of the
+ * buffer of the stream in blocks and the ones following the value are put
+ * back. Malformed data is read up to and including the offending character.
+ *
+ * @param in the input stream
+ * @return the read data
+ */
+auto readValueData(std::istream& in) -> std::string;
+}
+
+#endif /* SimpleJSON_Cursor_hpp */
@@ -0,0 +1,194 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Document_hpp
+#define SimpleJSON_Document_hpp
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "MappedFile.hpp"
+#include "Object.hpp"
+#include "Stats.hpp"
+
+namespace simple_json {
+/**
+ * @brief Represents a parsed JSON document that refers to its input buffer.
+ *
+ * All containers of the parsed data are allocated inside of an @c Arena
+ * owned by the document and freed at once together with the document.
+ *
+ * The strings of the parsed data are not copied: strings without escape
+ * sequences are stored as views into the input buffer, strings with escape
+ * sequences are decoded into the arena of the document. They are not
+ * contained as @c std::string : they are accessed using @c Value::asStringView() ,
+ * @c ObjectView::getStringView(std::string_view) and
+ * @c ObjectView::getStringViewBang(std::string_view) , whereas
+ * @c Value::as() and @c ObjectView::getBang(std::string_view) throw a
+ * @c std::bad_variant_access for them.
+ *
+ * The input buffer is either owned by the document, possibly as a mapped
+ * file, or borrowed, in which case it needs to outlive the document.
+ *
+ * The keys of the objects are still decoded into @c std::string , the key type
+ * of the object content: keys longer than its small-string buffer are
+ * allocated on the heap instead of the arena.
+ *
+ * Do note that the values of a document must not outlive the document. Copies
+ * of the contained values, including @c Object , are allocated on the heap
+ * and own copies of their strings, so they are independent of the document.
+ */
+class Document {
+    /** The input buffer if owned by this document. */
+    std::unique_ptr<std::string> buffer;
+    /** The mapped input file if owned by this document. */
+    MappedFile file;
+    /** The input data.                             */
+    std::string_view data;
+    /** The arena containing the parsed values.     */
+    std::unique_ptr<Arena> arena;
+    /** The parsed root value.                      */
+    Value root;
+
+    /**
+     * Creates the arena for the values parsed from the input data.
+     */
+    void createArena();
+
+    /**
+     * Parses the input data.
+     *
+     * @throws Exception if the parsing failed
+     */
+    void parse();
+
+public:
+    /**
+     * @brief Parses the given buffer.
+     *
+     * The buffer is borrowed and needs to outlive the document.
+     *
+     * @param data the buffer containing the JSON data
+     * @throws Exception if the parsing failed
+     */
+    explicit Document(std::string_view data);
+
+    /**
+     * @brief Parses the given null-terminated buffer.
+     *
+     * The buffer is borrowed and needs to outlive the document.
+     *
+     * @param data the buffer containing the JSON data
+     * @throws Exception if the parsing failed
+     */
+    inline explicit Document(const char* data): Document(std::string_view(data)) {}
+
+    /**
+     * Parses the given buffer, which is owned by the document.
+     *
+     * @param data the buffer containing the JSON data
+     * @throws Exception if the parsing failed
+     */
+    explicit Document(std::string&& data);
+
+    /**
+     * @brief Parses the remaining content of the given input stream, which is
+     * owned by the document.
+     *
+     * The stream is read to its end, including any data following the value.
+     *
+     * @param stream the input stream to read the JSON data from
+     * @throws Exception if the parsing failed
+     */
+    explicit Document(std::istream& stream);
+
+    /**
+     * Parses the content of the given mapped file, which is owned by the document.
+     *
+     * @param file the file containing the JSON data
+     * @throws Exception if the parsing failed
+     */
+    explicit Document(MappedFile&& file);
+
+#ifdef SIMPLE_JSON_STATS
+    /**
+     * @brief Parses the given buffer and collects the statistics of the parse.
+     *
+     * The buffer is borrowed and needs to outlive the document. The chunks of
+     * the arena are counted as the allocations of the parse.
+     *
+     * @param data the buffer containing the JSON data
+     * @param stats the statistics to add to
+     * @throws Exception if the parsing failed
+     */
+    Document(std::string_view data, ParseStats& stats);
+#endif
+
+    Document(const Document&) = delete;
+    Document(Document&&) = default;
+
+    auto operator=(const Document&) -> Document& = delete;
+
+    /**
+     * @brief Takes over the given document.
+     *
+     * The values of this document are destroyed before the arena and the
+     * input buffer they refer to.
+     *
+     * @param other the document to take over
+     * @return this document
+     */
+    auto operator=(Document&& other) noexcept -> Document&;
+
+    /**
+     * Returns the parsed root value.
+     *
+     * @return the root value
+     */
+    inline auto getRoot() const -> const Value& {
+        return root;
+    }
+
+    /**
+     * Returns the input data the document refers to.
+     *
+     * @return the input data
+     */
+    inline auto getData() const -> std::string_view {
+        return data;
+    }
+};
+
+/**
+ * @brief Parses the file at the given path.
+ *
+ * The file is mapped into memory and parsed directly from the mapping, which
+ * is owned by the returned document; the strings of the document refer to
+ * the mapping.
+ *
+ * @param path the path of the file
+ * @return the parsed document
+ * @throws std::system_error if the file cannot be opened or mapped
+ * @throws Exception if the parsing failed
+ */
+static inline auto parseFile(const std::string& path) -> Document {
+    return Document(MappedFile(path));
+}
+}
+
+#endif /* SimpleJSON_Document_hpp */
@@ -0,0 +1,89 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Error_hpp
+#define SimpleJSON_Error_hpp
+
+#include <string>
+
+namespace simple_json {
+/**
+ * An enumeration of the errors of the parser.
+ */
+enum class ErrorCode {
+    /** Another character was expected.                                 */
+    UnexpectedCharacter,
+    /** The data ended before the value was complete.                   */
+    UnexpectedEnd,
+    /** A string contains an invalid escape sequence.                   */
+    InvalidEscape,
+    /** A number is malformed or too large for a @c double .            */
+    InvalidNumber,
+    /** A value is neither a string, number, array, object nor literal. */
+    InvalidLiteral,
+    /** The data is not valid UTF-8.                                    */
+    InvalidUtf8,
+    /** A string contains an unescaped control character.               */
+    ControlCharacter,
+    /** The value is followed by other characters than whitespaces.     */
+    TrailingCharacters,
+    /** The arrays and objects are nested too deeply.                   */
+    TooDeep
+};
+
+/**
+ * @brief Describes an error of the parser.
+ *
+ * The error is a plain value, its message is only formatted on demand.
+ */
+struct Error {
+    /** The kind of error.                                             */
+    ErrorCode code;
+    /** The position of the error in the parsed input.                 */
+    long long position;
+    /** The expected character, if a specific character was expected. */
+    char expected = '\0';
+    /** The character found at the position of the error.             */
+    char got      = '\0';
+
+    /**
+     * Formats the message of this error, which is the same as the one of
+     * the @c Exception thrown for it.
+     *
+     * @return the message describing this error
+     */
+    inline auto message() const -> std::string {
+        std::string toReturn;
+        switch (code) {
+            case ErrorCode::UnexpectedCharacter:
+            case ErrorCode::UnexpectedEnd:
+                toReturn = std::string { "Expected '" } + expected + "', got '" + got + "'";
+                break;
+
+            case ErrorCode::InvalidEscape:  toReturn = "Invalid escape sequence";               break;
+            case ErrorCode::InvalidNumber:  toReturn = "Invalid number";                        break;
+            case ErrorCode::InvalidLiteral: toReturn = std::string("Unexpected '") + got + "'"; break;
+
+            case ErrorCode::InvalidUtf8:        toReturn = "Invalid UTF-8 sequence";                             break;
+            case ErrorCode::ControlCharacter:   toReturn = "Unescaped control character";                        break;
+            case ErrorCode::TrailingCharacters: toReturn = std::string("Unexpected '") + got + "' after the value"; break;
+            case ErrorCode::TooDeep:            toReturn = "Nesting too deep";                                   break;
+        }
+        return toReturn + ", position: " + std::to_string(position + 1);
+    }
+};
+}
+
+#endif /* SimpleJSON_Error_hpp */
@@ -16,16 +16,23 @@
 #ifndef SimpleJSON_Exception_hpp
 #define SimpleJSON_Exception_hpp
 
+#include <cstdio>
 #include <stdexcept>
 #include <string>
 
+#include "Error.hpp"
+
 namespace simple_json {
 /**
  * @brief Represents a parsing exception.
  *
- * Its message includes the location of the error in the parsed stream.
+ * Its message includes the location of the error in the parsed stream. The
+ * error itself is available using @c getError() .
  */
 class Exception: public std::runtime_error {
+    /** The error described by this exception. */
+    Error error;
+
 public:
     /**
      * Constructs an exception with the given information.
@@ -35,9 +42,53 @@ public:
      * @param pos the position in the stream
      */
     inline Exception(char expected, char got, long long pos):
-        std::runtime_error(std::string { "Expected '" } + expected + "', got '" + got + "', position: " + std::to_string(pos + 1)) {}
+        Exception(Error { got == static_cast<char>(EOF) ? ErrorCode::UnexpectedEnd : ErrorCode::UnexpectedCharacter, pos, expected, got }) {}
+
+    /**
+     * Constructs an exception with the given message.
+     *
+     * @param code the kind of error
+     * @param message the message describing the error
+     * @param pos the position in the stream
+     */
+    inline Exception(ErrorCode code, const std::string& message, long long pos):
+        std::runtime_error(message + ", position: " + std::to_string(pos + 1)), error { code, pos } {}
+
+    /**
+     * Constructs an exception for the given error of the parser.
+     *
+     * @param error the error
+     */
+    inline explicit Exception(const Error& error): std::runtime_error(error.message()), error(error) {}
 
     Exception() = delete;
+
+    /**
+     * Returns the error described by this exception.
+     *
+     * @return the error
+     */
+    inline auto getError() const noexcept -> const Error& {
+        return error;
+    }
+
+    /**
+     * Returns the kind of error described by this exception.
+     *
+     * @return the error code
+     */
+    inline auto getCode() const noexcept -> ErrorCode {
+        return error.code;
+    }
+
+    /**
+     * Returns the position of the error in the parsed input.
+     *
+     * @return the position of the error
+     */
+    inline auto getPosition() const noexcept -> long long {
+        return error.position;
+    }
 };
 }
 
@@ -0,0 +1,420 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Lazy_hpp
+#define SimpleJSON_Lazy_hpp
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "numbers.hpp"
+#include "Value.hpp"
+
+namespace simple_json {
+class LazyArray;
+class LazyObject;
+
+/**
+ * @brief A handle to a JSON value that has not been parsed yet.
+ *
+ * The value is parsed when it is accessed; only the accessed parts are
+ * materialized. Offers the same accessors as @c Value . Arrays are returned
+ * as @c LazyArray , objects as @c LazyObject .
+ *
+ * The handles refer to the parsed buffer, which needs to outlive them. Parts
+ * of the buffer that are skipped are only checked for balanced brackets and
+ * terminated strings.
+ */
+class LazyValue {
+    friend class LazyArray;
+    friend class LazyObject;
+
+    /** The complete JSON data.                      */
+    std::string_view data;
+    /** The first character of the referred value.   */
+    const char* start;
+
+    /**
+     * Reads the referred value as a number.
+     *
+     * @return the read number
+     * @throws Exception if the number is malformed
+     */
+    auto readNumber() const -> numbers::Number;
+
+    /**
+     * Reads and decodes the referred value as a string.
+     *
+     * @return the read string
+     * @throws Exception if the parsing failed
+     */
+    auto readString() const -> std::string;
+
+    /**
+     * Returns the position following the referred value.
+     *
+     * @return the end of the referred value
+     * @throws Exception if the value is not terminated
+     */
+    auto skip() const -> const char*;
+
+public:
+    /**
+     * Constructs a handle to the value starting at the given position.
+     *
+     * @param data the complete JSON data
+     * @param start the first character of the value
+     */
+    constexpr inline LazyValue(std::string_view data, const char* start): data(data), start(start) {}
+
+    /**
+     * Returns the type of the referred value. Numbers are read to determine
+     * their type.
+     *
+     * @return the type of the value
+     * @throws Exception if the value is a malformed number
+     */
+    inline auto getType() const -> ValueType {
+        switch (*start) {
+            case '{':           return ValueType::Object;
+            case '[':           return ValueType::Array;
+            case '"':           return ValueType::String;
+            case 't': case 'f': return ValueType::Bool;
+            case 'n':           return ValueType::Null;
+
+            default: return readNumber().type;
+        }
+    }
+
+    /**
+     * Returns whether the type of the referred value is equal to the given type.
+     *
+     * @param type the type to compare against
+     * @return whether the types match
+     */
+    inline auto is(ValueType type) const -> bool {
+        return getType() == type;
+    }
+
+    /**
+     * Returns the position of the referred value in the data.
+     *
+     * @return the offset of the first character of the value
+     */
+    inline auto getPosition() const -> std::size_t {
+        return static_cast<std::size_t>(start - data.data());
+    }
+
+    /**
+     * Returns the unparsed text of the referred value.
+     *
+     * @return the raw JSON text
+     * @throws Exception if the value is not terminated
+     */
+    inline auto getRaw() const -> std::string_view {
+        return std::string_view(start, static_cast<std::size_t>(skip() - start));
+    }
+
+    /**
+     * @brief Returns the referred value casted as the given type.
+     *
+     * Throws an exception if the referred value is not of the given type.
+     *
+     * @tparam T the value type to cast the referred value to
+     * @return the casted value
+     */
+    template<ValueType T>
+    inline auto as() const;
+
+    /**
+     * Parses the complete referred value.
+     *
+     * @return the parsed value
+     * @throws Exception if the parsing failed
+     */
+    auto materialize() const -> Value;
+};
+
+/**
+ * A handle to a JSON array that has not been parsed yet.
+ */
+class LazyArray {
+    /** The complete JSON data.     */
+    std::string_view data;
+    /** The opening bracket.        */
+    const char* start;
+
+public:
+    /**
+     * @brief An iterator over the elements of an array.
+     *
+     * Advancing the iterator skips the current element.
+     */
+    class Iterator {
+        /** The current element, its start is @c nullptr at the end. */
+        LazyValue current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = LazyValue;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const LazyValue*;
+        using reference         = const LazyValue&;
+
+        /**
+         * Constructs an iterator pointing to the given element.
+         *
+         * @param current the element
+         */
+        constexpr inline Iterator(LazyValue current): current(current) {}
+
+        inline auto operator*() const -> reference { return current; }
+        inline auto operator->() const -> pointer { return &current; }
+
+        auto operator++() -> Iterator&;
+
+        inline auto operator++(int) -> Iterator {
+            auto toReturn = *this;
+            ++*this;
+            return toReturn;
+        }
+
+        inline auto operator==(const Iterator& other) const -> bool { return current.start == other.current.start; }
+        inline auto operator!=(const Iterator& other) const -> bool { return current.start != other.current.start; }
+    };
+
+    /**
+     * Constructs a handle to the array starting at the given position.
+     *
+     * @param data the complete JSON data
+     * @param start the opening bracket of the array
+     */
+    constexpr inline LazyArray(std::string_view data, const char* start): data(data), start(start) {}
+
+    auto begin() const -> Iterator;
+    inline auto end() const -> Iterator { return LazyValue(data, nullptr); }
+
+    /**
+     * @brief Returns the amount of elements in the array.
+     *
+     * The elements are skipped, the counting takes linear time.
+     *
+     * @return the amount of elements
+     */
+    inline auto size() const -> std::size_t {
+        return static_cast<std::size_t>(std::distance(begin(), end()));
+    }
+
+    /**
+     * Returns whether the array is empty.
+     *
+     * @return whether there are no elements
+     */
+    inline auto empty() const -> bool {
+        return begin() == end();
+    }
+
+    /**
+     * @brief Returns the element at the given position.
+     *
+     * The preceding elements are skipped, the access takes linear time.
+     *
+     * @param position the position of the element
+     * @return the element
+     * @throws std::out_of_range if the position is out of range
+     */
+    inline auto operator[](std::size_t position) const -> LazyValue {
+        auto it = begin();
+        for (; position > 0 && it != end(); --position) {
+            ++it;
+        }
+        if (it == end()) {
+            throw std::out_of_range("simple_json::LazyArray::operator[]");
+        }
+        return *it;
+    }
+};
+
+/**
+ * @brief A handle to a JSON object that has not been parsed yet.
+ *
+ * Offers the same accessors as @c Object . Members are searched by scanning
+ * the whole object, skipping the values of other members without allocating.
+ * Like for @c Object , the last of duplicated keys wins.
+ */
+class LazyObject {
+    /** The complete JSON data. */
+    std::string_view data;
+    /** The opening bracket.    */
+    const char* start;
+
+public:
+    /**
+     * Constructs a handle to the object starting at the given position.
+     *
+     * @param data the complete JSON data
+     * @param start the opening bracket of the object
+     */
+    constexpr inline LazyObject(std::string_view data, const char* start): data(data), start(start) {}
+
+    /**
+     * Searches the value for the given key.
+     *
+     * @param name the key to search
+     * @return the value or @c std::nullopt if not found
+     * @throws Exception if the object is malformed
+     */
+    auto find(std::string_view name) const -> std::optional<LazyValue>;
+
+    /**
+     * @brief Gets the contained value for the given key.
+     *
+     * Throws an exception if the value is found but the type does not match
+     * the given type.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the value for the given key or @c std::nullopt if not found or @c null
+     */
+    template<ValueType T>
+    inline auto get(std::string_view name) const -> std::optional<decltype(std::declval<LazyValue>().as<T>())> {
+        if (const auto value = find(name); value && !value->is(ValueType::Null)) {
+            return value->as<T>();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets the contained object for the given key.
+     *
+     * Throws an exception if the value is found but is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the object for the given key or @c std::nullopt if not found or @c null
+     */
+    inline auto getObject(std::string_view name) const -> std::optional<LazyObject>;
+
+    /**
+     * @brief Returns the value referred to by the given key.
+     *
+     * Throws an exception if the value is not found or the type does not match.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value
+     */
+    template<ValueType T>
+    inline auto getBang(std::string_view name) const {
+        if (const auto value = find(name)) {
+            return value->as<T>();
+        }
+        throw std::out_of_range("simple_json::LazyObject::getBang");
+    }
+
+    /**
+     * @brief Gets the object referred to by the given key.
+     *
+     * Throws an exception if the object is not found or is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the mapped object
+     */
+    inline auto getObjectBang(std::string_view name) const -> LazyObject;
+
+    /**
+     * @brief Gets the object referred to by the given key and casts it to the
+     * given type.
+     *
+     * Uses the functional style cast.
+     *
+     * @param name the key whose mapped object to get
+     * @tparam T the type to construct from the contained JSON object
+     * @return the mapped object casted to the given type or @c std::nullopt if not found or @c null
+     */
+    template<typename T>
+    inline auto maybeGetAs(std::string_view name) const -> std::optional<T> {
+        static_assert(std::is_constructible_v<T, LazyObject>,
+                      "Given type must be constructible from simple_json::LazyObject");
+
+        if (auto object = getObject(name)) {
+            return T(*object);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Parses the complete object.
+     *
+     * @return the parsed object
+     * @throws Exception if the parsing failed
+     */
+    inline auto materialize() const -> ObjectContent {
+        return LazyValue(data, start).materialize().as<ValueType::Object>();
+    }
+};
+
+template<ValueType T>
+inline auto LazyValue::as() const {
+    if (!is(T)) {
+        throw std::bad_variant_access();
+    }
+    if constexpr (T == ValueType::Int) {
+        return readNumber().integer;
+    } else if constexpr (T == ValueType::UInt) {
+        return readNumber().unsignedInteger;
+    } else if constexpr (T == ValueType::Double) {
+        return readNumber().floating;
+    } else if constexpr (T == ValueType::String) {
+        return readString();
+    } else if constexpr (T == ValueType::Bool) {
+        return *start == 't';
+    } else if constexpr (T == ValueType::Array) {
+        return LazyArray(data, start);
+    } else if constexpr (T == ValueType::Object) {
+        return LazyObject(data, start);
+    } else {
+        static_assert(T != ValueType::Null, "null values cannot be casted");
+    }
+}
+
+inline auto LazyObject::getObject(std::string_view name) const -> std::optional<LazyObject> {
+    return get<ValueType::Object>(name);
+}
+
+inline auto LazyObject::getObjectBang(std::string_view name) const -> LazyObject {
+    return getBang<ValueType::Object>(name);
+}
+
+/**
+ * @brief Prepares the lazy parsing of the given buffer.
+ *
+ * Only the first character is checked; the data is parsed while it is
+ * accessed. The buffer needs to outlive the returned handle.
+ *
+ * @param data the buffer containing the JSON data
+ * @return a handle to the root value
+ * @throws Exception if the data does not start with an object or an array
+ */
+auto parseLazy(std::string_view data) -> LazyValue;
+}
+
+#endif /* SimpleJSON_Lazy_hpp */
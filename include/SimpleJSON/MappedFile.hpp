@@ -0,0 +1,79 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_MappedFile_hpp
+#define SimpleJSON_MappedFile_hpp
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace simple_json {
+/**
+ * @brief A file mapped read-only into memory.
+ *
+ * On platforms without @c mmap , or if the macro @c SIMPLE_JSON_NO_MMAP is
+ * defined when compiling the library, the file is read into a buffer instead.
+ */
+class MappedFile {
+    /** The start of the mapping, @c nullptr if not mapped. */
+    void* mapping = nullptr;
+    /** The size of the mapping in bytes.                   */
+    std::size_t mappingSize = 0;
+    /** The content if read into a buffer.                  */
+    std::vector<char> buffer;
+    /** The content of the file.                            */
+    std::string_view data;
+
+public:
+    /**
+     * Constructs an empty file.
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Maps the file at the given path.
+     *
+     * The mapping is advised to be read sequentially.
+     *
+     * @param path the path of the file
+     * @throws std::system_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+    /**
+     * Returns the content of the file.
+     *
+     * @return a view of the content, valid as long as this file
+     */
+    inline auto getData() const -> std::string_view {
+        return data;
+    }
+};
+}
+
+#endif /* SimpleJSON_MappedFile_hpp */
@@ -16,9 +16,11 @@
 #ifndef SimpleJSON_Object_hpp
 #define SimpleJSON_Object_hpp
 
-#include <map>
 #include <optional>
+#include <string_view>
+#include <utility>
 
+#include "ObjectView.hpp"
 #include "Value.hpp"
 
 namespace simple_json {
@@ -29,6 +31,7 @@ namespace simple_json {
  * the raw content of a JSON object (the @c ObjectContent type).
  *
  * Various accessors enable the simple usage of the content of an JSON object.
+ * Use @c view() to access nested objects without copying them.
  */
 struct Object {
     /** The raw content of this object. */
@@ -52,6 +55,40 @@ struct Object {
      */
     inline Object(const Value& value): Object(value.as<ValueType::Object>()) {}
 
+    /**
+     * Constructs a JSON object by moving the given raw JSON object content.
+     *
+     * @param content the raw JSON content
+     */
+    inline Object(ObjectContent&& content): content(std::move(content)) {}
+
+    /**
+     * @brief Constructs a JSON object by moving the content of the given JSON value.
+     *
+     * Will throw an exception if the given value does not contain a JSON object.
+     *
+     * @param value the JSON value
+     */
+    inline Object(Value&& value): Object(std::move(value).as<ValueType::Object>()) {}
+
+    /**
+     * Constructs a JSON object from a copy of the viewed JSON object.
+     *
+     * @param view the view of the JSON object
+     */
+    inline Object(ObjectView view): Object(view.getContent()) {}
+
+    /**
+     * Returns a non-owning view of this object.
+     *
+     * @return a view of this object
+     */
+    inline auto view() const& -> ObjectView {
+        return ObjectView(content);
+    }
+
+    auto view() const&& -> ObjectView = delete;
+
     /**
      * @brief Gets the contained value for the given key.
      *
@@ -63,12 +100,8 @@ struct Object {
      * @return the value for the given key or @c std::nullopt if not found or @c null
      */
     template<typename T>
-    constexpr inline auto get(const std::string& name) const -> std::optional<T> {
-        const auto& it = content.find(name);
-        if (it != content.end() && !it->second.is(ValueType::Null)) {
-            return std::get<T>(it->second.value);
-        }
-        return std::nullopt;
+    constexpr inline auto get(std::string_view name) const -> std::optional<T> {
+        return view().get<T>(name);
     }
 
     /**
@@ -82,25 +115,40 @@ struct Object {
      * @return the value for the given key or @c std::nullopt if not found or @c null
      */
     template<ValueType T>
-    constexpr inline auto get(const std::string& name) const {
+    constexpr inline auto get(std::string_view name) const {
         return get<typename Trait<T>::Type>(name);
     }
 
     /**
-     * @brief Gets the contained object for the given key.
+     * @brief Gets a copy of the contained object for the given key.
      *
      * Throws an exception if the value  is found but is not a JSON object.
+     * Use @c view() to access the nested object without copying it.
      *
      * @param name the key whose mapped object to get
      * @return the object for the given key or @c std::nullopt if not found or @c null
      */
-    inline auto getObject(const std::string& name) const -> std::optional<Object> {
-        if (auto object = get<ValueType::Object>(name)) {
-            return Object { *object };
+    inline auto getObject(std::string_view name) const -> std::optional<Object> {
+        if (const auto object = view().getObject(name)) {
+            return Object { object->getContent() };
         }
         return std::nullopt;
     }
 
+    /**
+     * @brief Gets a view of the contained string for the given key.
+     *
+     * Works for owned strings as well as for strings borrowed from the buffer
+     * of a @c Document . Throws an exception if the value is found but is not
+     * a string.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the string or @c std::nullopt if not found or @c null
+     */
+    inline auto getStringView(std::string_view name) const -> std::optional<std::string_view> {
+        return view().getStringView(name);
+    }
+
     /**
      * @brief Returns a reference to the value referred to by the given key.
      *
@@ -111,8 +159,8 @@ struct Object {
      * @return the mapped value
      */
     template<typename T>
-    constexpr inline auto getBang(const std::string& name) const -> const T& {
-        return std::get<T>(content.at(name).value);
+    constexpr inline auto getBang(std::string_view name) const -> const T& {
+        return view().getBang<T>(name);
     }
 
     /**
@@ -125,20 +173,95 @@ struct Object {
      * @return the mapped value
      */
     template<ValueType T>
-    constexpr inline auto getBang(const std::string& name) const -> const typename Trait<T>::Type& {
+    constexpr inline auto getBang(std::string_view name) const -> const typename Trait<T>::Type& {
         return getBang<typename Trait<T>::Type>(name);
     }
 
     /**
-     * @brief Gets the object referred to by the given key.
+     * @brief Returns a view of the string referred to by the given key.
+     *
+     * Works for owned strings as well as for strings borrowed from the buffer
+     * of a @c Document . Throws an exception if the value is not found or is
+     * not a string.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the mapped string
+     */
+    inline auto getStringViewBang(std::string_view name) const -> std::string_view {
+        return view().getStringViewBang(name);
+    }
+
+    /**
+     * @brief Gets a copy of the object referred to by the given key.
      *
      * Throws an exception if the object is not found or is not a JSON object.
+     * Use @c view() to access the nested object without copying it.
      *
      * @param name the key whose mapped object to get
      * @return the mapped object
      */
-    inline auto getObjectBang(const std::string& name) const -> Object {
-        return Object { getBang<ValueType::Object>(name) };
+    inline auto getObjectBang(std::string_view name) const -> Object {
+        return Object { view().getObjectBang(name) };
+    }
+
+    /**
+     * @brief Returns a pointer to the value referred to by the given key.
+     *
+     * Does not throw: if the value is not found, is @c null or the type does
+     * not match, @c nullptr is returned.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the type of the contained value
+     * @return the mapped value or @c nullptr
+     */
+    template<typename T>
+    inline auto tryGet(std::string_view name) const -> const T* {
+        return view().tryGet<T>(name);
+    }
+
+    /**
+     * @brief Returns a pointer to the value referred to by the given key.
+     *
+     * Does not throw: if the value is not found or the type does not match,
+     * @c nullptr is returned.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value or @c nullptr
+     */
+    template<ValueType T>
+    inline auto tryGet(std::string_view name) const -> const typename Trait<T>::Type* {
+        return view().tryGet<T>(name);
+    }
+
+    /**
+     * @brief Gets a copy of the object referred to by the given key.
+     *
+     * Does not throw: if the value is not found or is not a JSON object,
+     * @c std::nullopt is returned. Use @c view() to access the nested object
+     * without copying it.
+     *
+     * @param name the key whose mapped object to get
+     * @return the mapped object or @c std::nullopt
+     */
+    inline auto tryGetObject(std::string_view name) const -> std::optional<Object> {
+        if (const auto object = view().tryGetObject(name)) {
+            return Object { object->getContent() };
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets a view of the string referred to by the given key.
+     *
+     * Does not throw: if the value is not found or is not a string,
+     * @c std::nullopt is returned.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the mapped string or @c std::nullopt
+     */
+    inline auto tryGetStringView(std::string_view name) const -> std::optional<std::string_view> {
+        return view().tryGetStringView(name);
     }
 
     /**
@@ -158,7 +281,7 @@ struct Object {
     typename
 #endif
     T>
-    constexpr inline auto maybeGetAs(const std::string& name) const -> std::optional<T> {
+    constexpr inline auto maybeGetAs(std::string_view name) const -> std::optional<T> {
         static_assert(std::is_constructible_v<T, Object>,
                       "Given type must be constructible from simple_json::Object");
 
@@ -0,0 +1,576 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_ObjectContent_hpp
+#define SimpleJSON_ObjectContent_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Shared.hpp"
+
+namespace simple_json {
+/**
+ * @brief A map from strings to values that keeps its members in insertion order.
+ *
+ * The members are stored contiguously. Small maps are searched linearly, maps
+ * with more than @c indexThreshold members maintain a compact hash index.
+ *
+ * Copies share the members in constant time; the members are cloned when a
+ * shared map is modified through a non-const member function. Since the
+ * mapped values are copied the same way, modifying a nested value only clones
+ * the maps on the path to it. Shared maps may be read concurrently from
+ * multiple threads.
+ *
+ * Once a mutable reference or iterator has been handed out, copies copy the
+ * members instead of sharing them, until the map is cleared.
+ *
+ * Unlike the ones of a @c std::map , @c begin() and @c end() only return
+ * read-only iterators, also for a non-const map, so iterating never clones the
+ * members. Mutable iterators are returned by @c mutableBegin() and
+ * @c mutableEnd() ; do note that the keys must not be modified through them.
+ *
+ * @tparam T the type of the mapped values
+ * @tparam Allocator the allocator to be used
+ */
+template<typename T, typename Allocator>
+class BasicObjectContent {
+public:
+    using key_type        = std::string;
+    using mapped_type     = T;
+    using value_type      = std::pair<std::string, T>;
+    using size_type       = std::size_t;
+    using allocator_type  = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+    using iterator        = typename std::vector<value_type, allocator_type>::iterator;
+    using const_iterator  = typename std::vector<value_type, allocator_type>::const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /** The amount of members above which the hash index is used. */
+    static constexpr size_type indexThreshold = 8;
+
+private:
+    using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t>;
+
+    /** Marks a key that was not found. */
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    /**
+     * The shared data of a map.
+     */
+    struct Data {
+        /** The members in insertion order.                                 */
+        std::vector<value_type, allocator_type> members;
+        /** The hash index: the position of the members plus one per slot. */
+        std::vector<std::uint32_t, IndexAllocator> index;
+
+        template<typename A>
+        inline explicit Data(const A& allocator): members(allocator), index(allocator) {}
+    };
+
+    /** The possibly shared content of this map. */
+    Shared<Data, Allocator> content;
+
+    /**
+     * Hashes the given key.
+     *
+     * @param name the key to hash
+     * @return the hash value
+     */
+    static inline auto hash(std::string_view name) -> size_type {
+        return std::hash<std::string_view>()(name);
+    }
+
+    /**
+     * Returns the position of the member with the given key.
+     *
+     * @param name the key to search
+     * @return the position of the member or @c npos if not found
+     */
+    inline auto locate(std::string_view name) const -> size_type {
+        const auto shared = content.get();
+        if (shared == nullptr) {
+            return npos;
+        }
+        const auto& members = shared->members;
+        const auto& index   = shared->index;
+        if (index.empty()) {
+            for (size_type i = 0; i < members.size(); ++i) {
+                if (members[i].first == name) {
+                    return i;
+                }
+            }
+            return npos;
+        }
+        const auto mask = index.size() - 1;
+        for (auto slot = hash(name) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+            const auto position = size_type(index[slot] - 1);
+            if (members[position].first == name) {
+                return position;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * Adds the member at the given position to the hash index.
+     *
+     * @param data the data of this map
+     * @param position the position of the member
+     */
+    static inline void addToIndex(Data& data, size_type position) {
+        const auto mask = data.index.size() - 1;
+        auto slot = hash(data.members[position].first) & mask;
+        while (data.index[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        data.index[slot] = static_cast<std::uint32_t>(position + 1);
+    }
+
+    /**
+     * Rebuilds the hash index if the amount of members requires it.
+     *
+     * @param data the data of this map
+     */
+    static inline void updateIndex(Data& data) {
+        if (data.members.size() <= indexThreshold) {
+            data.index.clear();
+            return;
+        }
+        size_type slots = 16;
+        while (slots < data.members.size() * 2) {
+            slots *= 2;
+        }
+        data.index.assign(slots, 0);
+        for (size_type i = 0; i < data.members.size(); ++i) {
+            addToIndex(data, i);
+        }
+    }
+
+    /**
+     * Appends the given member without checking for an existing key.
+     *
+     * @param key the key of the member
+     * @param args the arguments to construct the value with
+     */
+    template<typename... Args>
+    inline void append(std::string&& key, Args&&... args) {
+        auto& mutableData = content.mutate();
+        mutableData.members.emplace_back(std::piecewise_construct,
+                                         std::forward_as_tuple(std::move(key)),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+        if (mutableData.index.empty() || mutableData.members.size() * 2 > mutableData.index.size()) {
+            updateIndex(mutableData);
+        } else {
+            addToIndex(mutableData, mutableData.members.size() - 1);
+        }
+    }
+
+    /**
+     * Returns the members for handing out mutable references to them,
+     * cloning them if they are shared. They are not shared anymore afterwards.
+     *
+     * @return the members
+     */
+    inline auto exposedMembers() -> std::vector<value_type, allocator_type>& {
+        return content.expose().members;
+    }
+
+    /**
+     * Assigns the given value to the member at the given position, or appends
+     * a member if the position is @c npos .
+     *
+     * @param position the position of the member with the key
+     * @param key the key of the member
+     * @param value the value to assign
+     * @return the position of the member
+     */
+    template<typename M>
+    inline auto assign(size_type position, std::string&& key, M&& value) -> size_type {
+        if (position == npos) {
+            append(std::move(key), std::forward<M>(value));
+            return size() - 1;
+        }
+        content.mutate().members[position].second = std::forward<M>(value);
+        return position;
+    }
+
+    /**
+     * Removes the member at the given position, keeping the order of the other members.
+     *
+     * @param position the position of the member
+     */
+    inline void remove(size_type position) {
+        auto& mutableData = content.mutate();
+        mutableData.members.erase(mutableData.members.cbegin() + static_cast<std::ptrdiff_t>(position));
+        updateIndex(mutableData);
+    }
+
+public:
+    BasicObjectContent() = default;
+
+    /**
+     * Constructs an empty map using the given allocator.
+     *
+     * @param allocator the allocator
+     */
+    inline explicit BasicObjectContent(const allocator_type& allocator): content(allocator) {}
+
+    /**
+     * @brief Returns a mutable iterator to the first member.
+     *
+     * Clones the members if they are shared with copies of this map.
+     *
+     * @return an iterator to the first member
+     */
+    inline auto mutableBegin() -> iterator {
+        return content.get() == nullptr ? iterator() : exposedMembers().begin();
+    }
+
+    /**
+     * @brief Returns the mutable end iterator.
+     *
+     * Clones the members if they are shared with copies of this map.
+     *
+     * @return the end iterator
+     */
+    inline auto mutableEnd() -> iterator {
+        return content.get() == nullptr ? iterator() : exposedMembers().end();
+    }
+
+    inline auto begin() const -> const_iterator { return cbegin(); }
+    inline auto end()   const -> const_iterator { return cend();   }
+
+    inline auto cbegin() const -> const_iterator {
+        return content.get() == nullptr ? const_iterator() : content.get()->members.cbegin();
+    }
+
+    inline auto cend() const -> const_iterator {
+        return content.get() == nullptr ? const_iterator() : content.get()->members.cend();
+    }
+
+    inline auto rbegin()  const -> const_reverse_iterator { return crbegin();                         }
+    inline auto rend()    const -> const_reverse_iterator { return crend();                           }
+    inline auto crbegin() const -> const_reverse_iterator { return const_reverse_iterator(cend());   }
+    inline auto crend()   const -> const_reverse_iterator { return const_reverse_iterator(cbegin()); }
+
+    inline auto mutableRbegin() -> reverse_iterator { return reverse_iterator(mutableEnd());   }
+    inline auto mutableRend()   -> reverse_iterator { return reverse_iterator(mutableBegin()); }
+
+    /**
+     * Returns the underlying array of the members in insertion order.
+     *
+     * @return the members or @c nullptr if this map has never held any
+     */
+    inline auto data() const -> const value_type* {
+        return content.get() == nullptr ? nullptr : content.get()->members.data();
+    }
+
+    inline auto size() const -> size_type {
+        return content.get() == nullptr ? 0 : content.get()->members.size();
+    }
+
+    inline auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    /**
+     * Reserves space for the given amount of members.
+     *
+     * @param capacity the amount of members
+     */
+    inline void reserve(size_type capacity) {
+        content.mutate().members.reserve(capacity);
+    }
+
+    /**
+     * Removes all members. The capacity is kept unless the members are
+     * shared with copies of this map.
+     */
+    inline void clear() {
+        if (content.isShared()) {
+            content = Shared<Data, Allocator>(content.getAllocator());
+        } else if (content.get() != nullptr) {
+            auto& mutableData = content.mutate();
+            mutableData.members.clear();
+            mutableData.index.clear();
+            content.share();
+        }
+    }
+
+    /**
+     * Searches the member with the given key.
+     *
+     * @param name the key to search
+     * @return an iterator to the member or the end iterator if not found
+     */
+    inline auto find(std::string_view name) -> iterator {
+        const auto position = locate(name);
+        return position == npos ? mutableEnd() : mutableBegin() + static_cast<std::ptrdiff_t>(position);
+    }
+
+    /**
+     * Searches the member with the given key.
+     *
+     * @param name the key to search
+     * @return an iterator to the member or the end iterator if not found
+     */
+    inline auto find(std::string_view name) const -> const_iterator {
+        const auto position = locate(name);
+        return position == npos ? end() : begin() + static_cast<std::ptrdiff_t>(position);
+    }
+
+    /**
+     * Returns the amount of members with the given key.
+     *
+     * @param name the key to search
+     * @return @c 1 if the key was found, @c 0 otherwise
+     */
+    inline auto count(std::string_view name) const -> size_type {
+        return locate(name) == npos ? 0 : 1;
+    }
+
+    /**
+     * Returns whether a member with the given key exists.
+     *
+     * @param name the key to search
+     * @return whether the key was found
+     */
+    inline auto contains(std::string_view name) const -> bool {
+        return locate(name) != npos;
+    }
+
+    /**
+     * Returns the value mapped to the given key.
+     *
+     * @param name the key to search
+     * @return the mapped value
+     * @throws std::out_of_range if the key is not found
+     */
+    inline auto at(std::string_view name) -> T& {
+        const auto position = locate(name);
+        if (position == npos) {
+            throw std::out_of_range("simple_json::ObjectContent::at");
+        }
+        return exposedMembers()[position].second;
+    }
+
+    /**
+     * Returns the value mapped to the given key.
+     *
+     * @param name the key to search
+     * @return the mapped value
+     * @throws std::out_of_range if the key is not found
+     */
+    inline auto at(std::string_view name) const -> const T& {
+        const auto position = locate(name);
+        if (position == npos) {
+            throw std::out_of_range("simple_json::ObjectContent::at");
+        }
+        return content.get()->members[position].second;
+    }
+
+    /**
+     * Returns the value mapped to the given key, appending a default
+     * constructed value if the key is not found.
+     *
+     * @param name the key to search
+     * @return the mapped value
+     */
+    inline auto operator[](std::string_view name) -> T& {
+        auto position = locate(name);
+        if (position == npos) {
+            append(std::string(name));
+            position = size() - 1;
+        }
+        return exposedMembers()[position].second;
+    }
+
+    /**
+     * Appends a member if the given key is not found.
+     *
+     * @param key the key of the member
+     * @param args the arguments to construct the value with
+     * @return an iterator to the member with the key and whether it was appended
+     */
+    template<typename... Args>
+    inline auto emplace(std::string key, Args&&... args) -> std::pair<iterator, bool> {
+        const auto position = locate(key);
+        if (position != npos) {
+            return { mutableBegin() + static_cast<std::ptrdiff_t>(position), false };
+        }
+        append(std::move(key), std::forward<Args>(args)...);
+        return { mutableEnd() - 1, true };
+    }
+
+    /**
+     * Appends the given member if its key is not found.
+     *
+     * @param member the member
+     * @return an iterator to the member with the key and whether it was appended
+     */
+    inline auto insert(const value_type& member) -> std::pair<iterator, bool> {
+        return emplace(member.first, member.second);
+    }
+
+    /**
+     * Appends the given member if its key is not found.
+     *
+     * @param member the member
+     * @return an iterator to the member with the key and whether it was appended
+     */
+    inline auto insert(value_type&& member) -> std::pair<iterator, bool> {
+        return emplace(std::move(member.first), std::move(member.second));
+    }
+
+    /**
+     * Appends the members of the given range whose keys are not found.
+     *
+     * @param first the first member to insert
+     * @param last the end of the range to insert
+     */
+    template<typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    inline void insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            const auto& [key, value] = *first;
+            if (locate(key) == npos) {
+                append(std::string(key), value);
+            }
+        }
+    }
+
+    /**
+     * Appends the given members whose keys are not found.
+     *
+     * @param members the members
+     */
+    inline void insert(std::initializer_list<value_type> members) {
+        insert(members.begin(), members.end());
+    }
+
+    /**
+     * Assigns the given value to the member with the given key, appending
+     * the member if the key is not found.
+     *
+     * @param key the key of the member
+     * @param value the value to assign
+     * @return an iterator to the member with the key and whether it was appended
+     */
+    template<typename M>
+    inline auto insert_or_assign(std::string key, M&& value) -> std::pair<iterator, bool> {
+        const auto found    = locate(key);
+        const auto position = assign(found, std::move(key), std::forward<M>(value));
+        return { mutableBegin() + static_cast<std::ptrdiff_t>(position), found == npos };
+    }
+
+    /**
+     * @brief Assigns the given value to the member with the given key,
+     * appending the member if the key is not found.
+     *
+     * Unlike @c insert_or_assign , no iterator is handed out, so the members
+     * stay shareable with copies of this map.
+     *
+     * @param key the key of the member
+     * @param value the value to assign
+     */
+    template<typename M>
+    inline void set(std::string key, M&& value) {
+        assign(locate(key), std::move(key), std::forward<M>(value));
+    }
+
+    /**
+     * Removes the given member, keeping the order of the other members.
+     *
+     * @param position the member to remove
+     * @return an iterator to the member following the removed one
+     */
+    inline auto erase(const_iterator position) -> iterator {
+        const auto offset = position - cbegin();
+        remove(static_cast<size_type>(offset));
+        return mutableBegin() + offset;
+    }
+
+    /**
+     * Removes the member with the given key, keeping the order of the other members.
+     *
+     * @param name the key of the member to remove
+     * @return the amount of removed members
+     */
+    inline auto erase(std::string_view name) -> size_type {
+        const auto position = locate(name);
+        if (position == npos) {
+            return 0;
+        }
+        remove(position);
+        return 1;
+    }
+
+    /**
+     * Returns whether the members are shared with copies of this map.
+     *
+     * @return whether the members are shared
+     */
+    inline auto isShared() const -> bool {
+        return content.isShared();
+    }
+
+    /**
+     * Returns the allocator of this map.
+     *
+     * @return the allocator
+     */
+    inline auto get_allocator() const -> allocator_type {
+        return content.getAllocator();
+    }
+
+    /**
+     * Compares the members of the given maps regardless of their order.
+     *
+     * @param lhs the one map
+     * @param rhs the other map
+     * @return whether the maps contain the same keys mapped to equal values
+     */
+    friend inline auto operator==(const BasicObjectContent& lhs, const BasicObjectContent& rhs) -> bool {
+        if (lhs.content.get() == rhs.content.get()) {
+            return true;
+        }
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (const auto& [key, value] : lhs) {
+            const auto position = rhs.locate(key);
+            if (position == npos || !(rhs.content.get()->members[position].second == value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend inline auto operator!=(const BasicObjectContent& lhs, const BasicObjectContent& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+};
+}
+
+#endif /* SimpleJSON_ObjectContent_hpp */
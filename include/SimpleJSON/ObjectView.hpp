@@ -0,0 +1,281 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_ObjectView_hpp
+#define SimpleJSON_ObjectView_hpp
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include "Value.hpp"
+
+namespace simple_json {
+/**
+ * @brief A non-owning view of a JSON object.
+ *
+ * Offers the same accessors as @c Object without copying the viewed content.
+ * Nested objects are returned as views as well.
+ *
+ * Do note that a view must not outlive the viewed content.
+ */
+class ObjectView {
+    /** The viewed content. */
+    const ObjectContent* content;
+
+public:
+    /**
+     * Constructs a view of the given raw JSON object content.
+     *
+     * @param content the raw JSON content
+     */
+    constexpr inline ObjectView(const ObjectContent& content): content(&content) {}
+
+    /**
+     * @brief Constructs a view of the JSON object contained in the given value.
+     *
+     * Will throw an exception if the given value does not contain a JSON object.
+     *
+     * @param value the JSON value
+     */
+    inline ObjectView(const Value& value): content(&value.as<ValueType::Object>()) {}
+
+    ObjectView(ObjectContent&&) = delete;
+    ObjectView(Value&&) = delete;
+
+    /**
+     * Returns the viewed raw content.
+     *
+     * @return the raw JSON content
+     */
+    constexpr inline auto getContent() const -> const ObjectContent& {
+        return *content;
+    }
+
+    /**
+     * @brief Gets the contained value for the given key.
+     *
+     * Throws an exception if the value is found but the type does not match
+     * the given type. Borrowed strings of a @c Document are copied.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the type of the contained value
+     * @return the value for the given key or @c std::nullopt if not found or @c null
+     */
+    template<typename T>
+    constexpr inline auto get(std::string_view name) const -> std::optional<T> {
+        const auto& it = content->find(name);
+        if (it != content->end() && !it->second.is(ValueType::Null)) {
+            if constexpr (std::is_same_v<T, Trait<ValueType::String>::Type>) {
+                return T(it->second.asStringView());
+            } else {
+                return std::get<T>(it->second.value);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets the contained value for the given key.
+     *
+     * Throws an exception if the value is found but the type does not match
+     * the given type.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the value for the given key or @c std::nullopt if not found or @c null
+     */
+    template<ValueType T>
+    constexpr inline auto get(std::string_view name) const {
+        return get<typename Trait<T>::Type>(name);
+    }
+
+    /**
+     * @brief Gets a view of the contained object for the given key.
+     *
+     * Throws an exception if the value is found but is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return a view of the object for the given key or @c std::nullopt if not found or @c null
+     */
+    inline auto getObject(std::string_view name) const -> std::optional<ObjectView> {
+        const auto& it = content->find(name);
+        if (it != content->end() && !it->second.is(ValueType::Null)) {
+            return ObjectView(it->second);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets a view of the contained string for the given key.
+     *
+     * Throws an exception if the value is found but is not a string.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the string or @c std::nullopt if not found or @c null
+     */
+    inline auto getStringView(std::string_view name) const -> std::optional<std::string_view> {
+        const auto& it = content->find(name);
+        if (it != content->end() && !it->second.is(ValueType::Null)) {
+            return it->second.asStringView();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Returns a reference to the value referred to by the given key.
+     *
+     * Throws an exception if the value is not found or the type does not match.
+     * Borrowed strings of a @c Document are not contained as @c std::string ,
+     * use @c getStringViewBang(std::string_view) for them.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the type of the contained value
+     * @return the mapped value
+     */
+    template<typename T>
+    constexpr inline auto getBang(std::string_view name) const -> const T& {
+        return std::get<T>(content->at(name).value);
+    }
+
+    /**
+     * @brief Returns a reference to the value referred to by the given key.
+     *
+     * Throws an exception if the value is not found or the type does not match.
+     * Borrowed strings of a @c Document are not contained as @c std::string ,
+     * use @c getStringViewBang(std::string_view) for them.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value
+     */
+    template<ValueType T>
+    constexpr inline auto getBang(std::string_view name) const -> const typename Trait<T>::Type& {
+        return getBang<typename Trait<T>::Type>(name);
+    }
+
+    /**
+     * @brief Returns a view of the string referred to by the given key.
+     *
+     * Throws an exception if the value is not found or is not a string.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the mapped string
+     */
+    inline auto getStringViewBang(std::string_view name) const -> std::string_view {
+        return content->at(name).asStringView();
+    }
+
+    /**
+     * @brief Gets a view of the object referred to by the given key.
+     *
+     * Throws an exception if the object is not found or is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return a view of the mapped object
+     */
+    inline auto getObjectBang(std::string_view name) const -> ObjectView {
+        return ObjectView(content->at(name));
+    }
+
+    /**
+     * @brief Returns a pointer to the value referred to by the given key.
+     *
+     * Does not throw: if the value is not found, is @c null or the type does
+     * not match, @c nullptr is returned.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the type of the contained value
+     * @return the mapped value or @c nullptr
+     */
+    template<typename T>
+    inline auto tryGet(std::string_view name) const -> const T* {
+        const auto& it = content->find(name);
+        if (it != content->end() && !it->second.is(ValueType::Null)) {
+            return std::get_if<T>(&it->second.value);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns a pointer to the value referred to by the given key.
+     *
+     * Does not throw: if the value is not found or the type does not match,
+     * @c nullptr is returned.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value or @c nullptr
+     */
+    template<ValueType T>
+    inline auto tryGet(std::string_view name) const -> const typename Trait<T>::Type* {
+        const auto& it = content->find(name);
+        return it != content->end() ? it->second.template tryAs<T>() : nullptr;
+    }
+
+    /**
+     * @brief Gets a view of the object referred to by the given key.
+     *
+     * Does not throw: if the value is not found or is not a JSON object,
+     * @c std::nullopt is returned.
+     *
+     * @param name the key whose mapped object to get
+     * @return a view of the mapped object or @c std::nullopt
+     */
+    inline auto tryGetObject(std::string_view name) const -> std::optional<ObjectView> {
+        if (const auto object = tryGet<ValueType::Object>(name)) {
+            return ObjectView(*object);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets a view of the string referred to by the given key.
+     *
+     * Does not throw: if the value is not found or is not a string,
+     * @c std::nullopt is returned.
+     *
+     * @param name the key whose mapped string to get
+     * @return a view of the mapped string or @c std::nullopt
+     */
+    inline auto tryGetStringView(std::string_view name) const -> std::optional<std::string_view> {
+        const auto& it = content->find(name);
+        return it != content->end() ? it->second.tryAsStringView() : std::nullopt;
+    }
+
+    /**
+     * @brief Gets the object referred to by the given key and casts it to the
+     * given type.
+     *
+     * Uses the functional style cast with a view of the object.
+     *
+     * @param name the key whose mapped object to get
+     * @tparam T the type to construct from the view of the contained JSON object
+     * @return the mapped object casted to the given type or @c std::nullopt if not found or @c null
+     */
+    template<typename T>
+    constexpr inline auto maybeGetAs(std::string_view name) const -> std::optional<T> {
+        static_assert(std::is_constructible_v<T, ObjectView>,
+                      "Given type must be constructible from simple_json::ObjectView");
+
+        if (const auto object = getObject(name)) {
+            return T(*object);
+        }
+        return std::nullopt;
+    }
+};
+}
+
+#endif /* SimpleJSON_ObjectView_hpp */
@@ -0,0 +1,181 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Parallel_hpp
+#define SimpleJSON_Parallel_hpp
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string_view>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "Value.hpp"
+
+namespace simple_json {
+/**
+ * The options of a parallel parse.
+ */
+struct ParallelOptions {
+    /** The amount of threads, @c 0 for one per hardware thread; ignored if a pool is given. */
+    std::size_t threads = 0;
+    /** The approximate size of the chunks parsed by a task, in bytes.               */
+    std::size_t chunkSize = 1 << 20;
+    /** Whether the values are passed to the consumer in the order of the input.    */
+    bool ordered = true;
+};
+
+/**
+ * The function the values of a parallel parse are passed to.
+ */
+using ValueConsumer = std::function<void(Value&)>;
+
+/**
+ * @brief Parses the newline delimited JSON values (NDJSON) of the given buffer
+ * in parallel on the given thread pool.
+ *
+ * The buffer is split at line breaks into chunks of about the configured size,
+ * which are parsed by the tasks of the pool. A value must not span multiple
+ * lines; blank lines are allowed.
+ *
+ * If the values are ordered, the consumer is called by the calling thread
+ * with the values in the order of the input; at most four chunks per thread
+ * are parsed ahead. Otherwise, the consumer is called by the threads of the
+ * pool as soon as a value is parsed, possibly concurrently.
+ *
+ * The consumer may move the passed values. If it throws or a value is
+ * malformed, the remaining chunks are skipped and the first exception is
+ * rethrown once the started tasks are finished.
+ *
+ * The function must not be called from a task of the given pool.
+ *
+ * @param data the buffer containing the JSON values
+ * @param consumer the function called with every parsed value
+ * @param pool the thread pool to parse on
+ * @param options the options of the parse
+ * @throws Exception if the parsing failed
+ */
+void parseParallel(std::string_view data, const ValueConsumer& consumer, ThreadPool& pool, const ParallelOptions& options = {});
+
+/**
+ * @brief Parses the newline delimited JSON values (NDJSON) of the given buffer
+ * in parallel.
+ *
+ * A thread pool with the configured amount of threads is created for the
+ * parse.
+ *
+ * @param data the buffer containing the JSON values
+ * @param consumer the function called with every parsed value
+ * @param options the options of the parse
+ * @throws Exception if the parsing failed
+ * @see parseParallel(std::string_view, const ValueConsumer&, ThreadPool&, const ParallelOptions&)
+ */
+static inline void parseParallel(std::string_view data, const ValueConsumer& consumer, const ParallelOptions& options = {}) {
+    ThreadPool pool(options.threads);
+    parseParallel(data, consumer, pool, options);
+}
+
+/**
+ * @brief Parses the newline delimited JSON values (NDJSON) remaining in the
+ * given input stream in parallel.
+ *
+ * The stream is read at once before the parsing starts.
+ *
+ * @param stream the input stream to read the JSON values from
+ * @param consumer the function called with every parsed value
+ * @param options the options of the parse
+ * @throws Exception if the parsing failed
+ * @see parseParallel(std::string_view, const ValueConsumer&, ThreadPool&, const ParallelOptions&)
+ */
+void parseParallel(std::istream& stream, const ValueConsumer& consumer, const ParallelOptions& options = {});
+
+/**
+ * @brief Parses the elements of the array at the given path in the given
+ * buffer in parallel on the given thread pool.
+ *
+ * The structural characters of the array are indexed first; the array is
+ * then split at its separating commas into ranges of elements of about the
+ * configured chunk size, which are parsed by the tasks of the pool directly
+ * into their place in the returned array.
+ *
+ * The path consists of the keys of the nested objects leading to the array,
+ * the root needs to be an array if it is empty. The content following the
+ * array is not read.
+ *
+ * The function must not be called from a task of the given pool.
+ *
+ * @param data the buffer containing the JSON data
+ * @param path the keys leading to the array
+ * @param pool the thread pool to parse on
+ * @param options the options of the parse, the order is ignored
+ * @return the elements of the array
+ * @throws Exception if the parsing failed
+ * @throws std::out_of_range if a key of the path is not found
+ * @throws std::bad_variant_access if a value of the path has another type
+ */
+auto parseArrayParallel(std::string_view data, const std::vector<std::string_view>& path, ThreadPool& pool,
+                        const ParallelOptions& options = {}) -> ArrayContent;
+
+/**
+ * @brief Parses the elements of the array at the given path in the given
+ * buffer in parallel.
+ *
+ * A thread pool with the configured amount of threads is created for the
+ * parse.
+ *
+ * @param data the buffer containing the JSON data
+ * @param path the keys leading to the array
+ * @param options the options of the parse, the order is ignored
+ * @return the elements of the array
+ * @throws Exception if the parsing failed
+ * @see parseArrayParallel(std::string_view, const std::vector<std::string_view>&, ThreadPool&, const ParallelOptions&)
+ */
+static inline auto parseArrayParallel(std::string_view data, const std::vector<std::string_view>& path,
+                                      const ParallelOptions& options = {}) -> ArrayContent {
+    ThreadPool pool(options.threads);
+    return parseArrayParallel(data, path, pool, options);
+}
+
+/**
+ * Parses the elements of the root array of the given buffer in parallel on
+ * the given thread pool.
+ *
+ * @param data the buffer containing the JSON data
+ * @param pool the thread pool to parse on
+ * @param options the options of the parse, the order is ignored
+ * @return the elements of the array
+ * @throws Exception if the parsing failed
+ * @see parseArrayParallel(std::string_view, const std::vector<std::string_view>&, ThreadPool&, const ParallelOptions&)
+ */
+static inline auto parseArrayParallel(std::string_view data, ThreadPool& pool, const ParallelOptions& options = {}) -> ArrayContent {
+    return parseArrayParallel(data, {}, pool, options);
+}
+
+/**
+ * Parses the elements of the root array of the given buffer in parallel.
+ *
+ * @param data the buffer containing the JSON data
+ * @param options the options of the parse, the order is ignored
+ * @return the elements of the array
+ * @throws Exception if the parsing failed
+ * @see parseArrayParallel(std::string_view, const std::vector<std::string_view>&, ThreadPool&, const ParallelOptions&)
+ */
+static inline auto parseArrayParallel(std::string_view data, const ParallelOptions& options = {}) -> ArrayContent {
+    return parseArrayParallel(data, {}, options);
+}
+}
+
+#endif /* SimpleJSON_Parallel_hpp */
@@ -0,0 +1,97 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_PushParser_hpp
+#define SimpleJSON_PushParser_hpp
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include "Value.hpp"
+
+namespace simple_json {
+/**
+ * @brief Parses a JSON object or array arriving in chunks.
+ *
+ * The chunks are passed using @c feed() as they arrive; the parsing of a
+ * chunk continues where the previous chunk ended, so that the parsing
+ * overlaps with the receiving of the data. The parsed value is returned by
+ * @c finish() .
+ *
+ * After an exception, the parser cannot be continued.
+ *
+ * @see PushReader
+ */
+class PushParser {
+    struct State;
+
+    /** The state of the parser. */
+    std::unique_ptr<State> state;
+
+public:
+    /**
+     * Constructs a parser waiting for the first chunk.
+     */
+    PushParser();
+
+    PushParser(PushParser&&) noexcept;
+    auto operator=(PushParser&&) noexcept -> PushParser&;
+    ~PushParser();
+
+    /**
+     * @brief Parses the given chunk of data.
+     *
+     * Once the root value is complete, the remaining data is not consumed.
+     *
+     * @param data the chunk
+     * @param size the size of the chunk in bytes
+     * @return the amount of consumed bytes
+     * @throws Exception if the parsing failed
+     */
+    auto feed(const char* data, std::size_t size) -> std::size_t;
+
+    /**
+     * Parses the given chunk of data.
+     *
+     * @param data the chunk
+     * @return the amount of consumed bytes
+     * @throws Exception if the parsing failed
+     */
+    inline auto feed(std::string_view data) -> std::size_t {
+        return feed(data.data(), data.size());
+    }
+
+    /**
+     * Returns whether the root value is complete.
+     *
+     * @return whether the parsing is done
+     */
+    auto isDone() const -> bool;
+
+    /**
+     * @brief Signals the end of the data and returns the parsed value.
+     *
+     * The errors are the same as the ones of @c parse given the whole data.
+     * Afterwards, the parser can be reused for the next document.
+     *
+     * @return the parsed value
+     * @throws Exception if the root value is incomplete
+     */
+    auto finish() -> Value;
+};
+}
+
+#endif /* SimpleJSON_PushParser_hpp */
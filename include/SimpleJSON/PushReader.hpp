@@ -0,0 +1,510 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_PushReader_hpp
+#define SimpleJSON_PushReader_hpp
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Cursor.hpp"
+#include "Error.hpp"
+#include "Exception.hpp"
+#include "numbers.hpp"
+#include "scanner.hpp"
+#include "strings.hpp"
+
+namespace simple_json {
+/**
+ * @brief Parses JSON data arriving in chunks and reports its content to a handler.
+ *
+ * The data is passed in consecutive chunks using @c feed() ; every chunk is
+ * parsed as far as possible before the call returns, and the parsing resumes
+ * with the next chunk exactly where it stopped. Instead of recursing into
+ * arrays and objects, the reader keeps the open containers on an explicit
+ * stack, limited to @c maxDepth containers like the recursion of a @c Reader .
+ *
+ * The handler is the same as the one of a @c Reader . The views passed to
+ * @c key and @c string are only valid during the call; strings that are
+ * complete within a chunk and contain no escape sequences are views into the
+ * chunk.
+ *
+ * After an exception, the reader cannot be continued.
+ *
+ * @tparam Handler the type of the handler
+ * @see Reader
+ */
+template<typename Handler>
+class PushReader {
+    /**
+     * The element expected next.
+     */
+    enum class State : char {
+        /** The opening bracket of the root object or array. */
+        Root,
+        /** The value of an object member. */
+        Value,
+        /** An element or the closing bracket of an array. */
+        Element,
+        /** A separator or the closing bracket of an array. */
+        ElementEnd,
+        /** A key or the closing bracket of an object. */
+        Member,
+        /** A separator or the closing bracket of an object. */
+        MemberEnd,
+        /** The colon following a key. */
+        Colon,
+        /** Nothing, the root value is complete. */
+        Done
+    };
+
+    /**
+     * The kind of a lexeme not completed by the previous chunk.
+     */
+    enum class Lexeme : char {
+        /** No lexeme is pending. */
+        None,
+        /** A string value. */
+        String,
+        /** The key of an object member. */
+        Key,
+        /** A number or literal. */
+        Token
+    };
+
+    /** The handler the parsed elements are reported to.                */
+    Handler& handler;
+    /** The opening brackets of the open containers.                    */
+    std::vector<char> containers;
+    /** The expected element.                                           */
+    State state = State::Root;
+    /** The pending lexeme.                                             */
+    Lexeme lexeme = Lexeme::None;
+    /** Whether the pending string contains escape sequences.           */
+    bool escaped = false;
+    /** The part of the pending lexeme contained in previous chunks.    */
+    std::string pending;
+    /** The buffer for decoded strings.                                 */
+    std::string buffer;
+    /** The position of the current chunk in the input.                 */
+    long long offset = 0;
+    /** The position of the content of the pending lexeme in the input. */
+    long long lexemeStart = 0;
+    /** The current chunk.                                              */
+    const char* chunk = nullptr;
+
+    /**
+     * Returns the position in the input of the given character of the current chunk.
+     *
+     * @param character the character
+     * @return the position of the character
+     */
+    inline auto positionOf(const char* character) const -> long long {
+        return offset + (character - chunk);
+    }
+
+    /**
+     * Creates the error for the given unexpected character of the current chunk.
+     *
+     * @param character the unexpected character
+     * @param expected the expected character
+     * @return the error
+     */
+    inline auto unexpected(const char* character, char expected) const -> Error {
+        return Error { ErrorCode::UnexpectedCharacter, positionOf(character), expected, *character };
+    }
+
+    /**
+     * Sets the expected element following a complete value.
+     */
+    inline void endValue() {
+        lexeme = Lexeme::None;
+        if (containers.empty()) {
+            state = State::Done;
+        } else {
+            state = containers.back() == '[' ? State::ElementEnd : State::MemberEnd;
+        }
+    }
+
+    /**
+     * Opens a container.
+     *
+     * @param bracket the opening bracket of the container in the current chunk
+     * @throws Exception if the maximum depth is exceeded
+     */
+    inline void open(const char* bracket) {
+        if (containers.size() == maxDepth) {
+            throw Exception(Error { ErrorCode::TooDeep, positionOf(bracket) });
+        }
+        containers.push_back(*bracket);
+        if (*bracket == '{') {
+            handler.startObject();
+            state = State::Member;
+        } else {
+            handler.startArray();
+            state = State::Element;
+        }
+    }
+
+    /**
+     * Closes the innermost container.
+     */
+    inline void close() {
+        const auto bracket = containers.back();
+        containers.pop_back();
+        if (bracket == '{') {
+            handler.endObject();
+        } else {
+            handler.endArray();
+        }
+        endValue();
+    }
+
+    /**
+     * Reports the pending string.
+     *
+     * @param raw the raw content of the string
+     * @throws Exception if an invalid escape sequence is found
+     */
+    inline void endString(std::string_view raw) {
+        auto content = raw;
+        if (escaped) {
+            buffer.resize(raw.size());
+            auto begin = raw.data();
+            const auto last = strings::unescape(begin, raw.data() + raw.size(), buffer.data());
+            if (last == nullptr) {
+                throw Exception(Error { ErrorCode::InvalidEscape, lexemeStart + (begin - raw.data()) });
+            }
+            content = std::string_view(buffer.data(), static_cast<std::size_t>(last - buffer.data()));
+        }
+        if (lexeme == Lexeme::Key) {
+            handler.key(content);
+            lexeme = Lexeme::None;
+            state  = State::Colon;
+        } else {
+            handler.string(content);
+            endValue();
+        }
+    }
+
+    /**
+     * Reads the content of the pending string.
+     *
+     * @param current the current character
+     * @param end the end of the chunk
+     * @return the character following the string or the end of the chunk
+     * @throws Exception if an invalid escape sequence is found
+     */
+    inline auto readString(const char* current, const char* end) -> const char* {
+        // The first character is escaped if the previous chunk ended within an escape sequence.
+        if (!pending.empty() && current < end) {
+            std::size_t backslashes = 0;
+            for (auto it = pending.rbegin(); it != pending.rend() && *it == '\\'; ++it) {
+                ++backslashes;
+            }
+            if (backslashes % 2 != 0) {
+                pending.push_back(*current++);
+            }
+        }
+        bool found;
+        const auto quote = strings::findEnd(current, end, found);
+        escaped = escaped || found;
+        if (quote == end) {
+            pending.append(current, end);
+            return end;
+        }
+        if (pending.empty()) {
+            endString(std::string_view(current, static_cast<std::size_t>(quote - current)));
+        } else {
+            pending.append(current, quote);
+            endString(pending);
+            pending.clear();
+        }
+        return quote + 1;
+    }
+
+    /**
+     * Reports the pending token.
+     *
+     * @param token the token
+     * @throws Exception if the token is not a valid primitive value
+     */
+    inline void endToken(std::string_view token) {
+        const auto end = token.data() + token.size();
+        if (isNumberStart(token.front())) {
+            numbers::Number number;
+            if (numbers::parse(token.data(), end, number) != end) {
+                throw Exception(Error { ErrorCode::InvalidNumber, lexemeStart });
+            }
+            reportNumber(handler, number);
+        } else if (token == "true") {
+            handler.boolean(true);
+        } else if (token == "false") {
+            handler.boolean(false);
+        } else if (token == "null") {
+            handler.null();
+        } else {
+            throw Exception(Error { ErrorCode::InvalidLiteral, lexemeStart, '\0', token.front() });
+        }
+        endValue();
+    }
+
+    /**
+     * Reads the pending token: the characters up to the next whitespace,
+     * separator or closing bracket.
+     *
+     * @param current the current character
+     * @param end the end of the chunk
+     * @return the character following the token or the end of the chunk
+     */
+    inline auto readToken(const char* current, const char* end) -> const char* {
+        const auto begin = current;
+        while (current < end && !isDelimiter(*current)) {
+            ++current;
+        }
+        if (current == end) {
+            pending.append(begin, end);
+        } else if (pending.empty()) {
+            endToken(std::string_view(begin, static_cast<std::size_t>(current - begin)));
+        } else {
+            pending.append(begin, current);
+            endToken(pending);
+            pending.clear();
+        }
+        return current;
+    }
+
+    /**
+     * Starts reading a key.
+     *
+     * @param current the opening quote
+     * @param end the end of the chunk
+     * @return the character following the read part of the key
+     * @throws Exception if the current character is not a quote
+     */
+    inline auto startKey(const char* current, const char* end) -> const char* {
+        if (*current != '"') {
+            throw Exception(unexpected(current, '"'));
+        }
+        lexeme      = Lexeme::Key;
+        escaped     = false;
+        lexemeStart = positionOf(current) + 1;
+        return readString(current + 1, end);
+    }
+
+    /**
+     * Starts reading any JSON value.
+     *
+     * @param current the first character of the value
+     * @param end the end of the chunk
+     * @return the character following the read part of the value
+     * @throws Exception if no value is found
+     */
+    inline auto startValue(const char* current, const char* end) -> const char* {
+        switch (*current) {
+            case '"':
+                lexeme      = Lexeme::String;
+                escaped     = false;
+                lexemeStart = positionOf(current) + 1;
+                return readString(current + 1, end);
+
+            case '[':
+            case '{':
+                open(current);
+                return current + 1;
+
+            case ',':
+            case ']':
+            case '}':
+                throw Exception(Error { ErrorCode::InvalidLiteral, positionOf(current), '\0', *current });
+
+            default:
+                lexeme      = Lexeme::Token;
+                lexemeStart = positionOf(current);
+                return readToken(current, end);
+        }
+    }
+
+    /**
+     * Reads the next element.
+     *
+     * @param current the first character of the element
+     * @param end the end of the chunk
+     * @return the character following the read part of the element
+     * @throws Exception if the parsing failed
+     */
+    inline auto step(const char* current, const char* end) -> const char* {
+        const auto character = *current;
+        switch (state) {
+            case State::Root:
+                if (character != '{' && character != '[') {
+                    throw Exception(unexpected(current, '{'));
+                }
+                open(current);
+                return current + 1;
+
+            case State::ElementEnd:
+                if (character == ',') {
+                    state = State::Element;
+                    return current + 1;
+                }
+                [[fallthrough]];
+            case State::Element:
+                if (character == ']') {
+                    close();
+                    return current + 1;
+                }
+                return startValue(current, end);
+
+            case State::MemberEnd:
+                if (character == ',') {
+                    state = State::Member;
+                    return current + 1;
+                }
+                [[fallthrough]];
+            case State::Member:
+                if (character == '}') {
+                    close();
+                    return current + 1;
+                }
+                return startKey(current, end);
+
+            case State::Colon:
+                if (character != ':') {
+                    throw Exception(unexpected(current, ':'));
+                }
+                state = State::Value;
+                return current + 1;
+
+            case State::Value: return startValue(current, end);
+            case State::Done:  return current;
+        }
+        return current;
+    }
+
+public:
+    /** The maximum nesting depth of arrays and objects. */
+    static constexpr std::size_t maxDepth = 1024;
+
+    /**
+     * Constructs a reader reporting to the given handler.
+     *
+     * @param handler the handler
+     */
+    inline explicit PushReader(Handler& handler): handler(handler) {}
+
+    /**
+     * @brief Parses the given chunk of data.
+     *
+     * Once the root value is complete, the remaining data is not consumed.
+     *
+     * @param data the chunk
+     * @param size the size of the chunk in bytes
+     * @return the amount of consumed bytes
+     * @throws Exception if the parsing failed
+     */
+    auto feed(const char* data, std::size_t size) -> std::size_t {
+        chunk = data;
+        const auto end = data + size;
+        auto current = data;
+        switch (lexeme) {
+            case Lexeme::String:
+            case Lexeme::Key:   current = readString(current, end); break;
+            case Lexeme::Token: current = readToken(current, end);  break;
+
+            default: break;
+        }
+        while (current < end && state != State::Done) {
+            current = scanner::skipWhitespaces(current, end);
+            if (current < end) {
+                current = step(current, end);
+            }
+        }
+        const auto consumed = static_cast<std::size_t>(current - data);
+        offset += static_cast<long long>(consumed);
+        return consumed;
+    }
+
+    /**
+     * Parses the given chunk of data.
+     *
+     * @param data the chunk
+     * @return the amount of consumed bytes
+     * @throws Exception if the parsing failed
+     */
+    inline auto feed(std::string_view data) -> std::size_t {
+        return feed(data.data(), data.size());
+    }
+
+    /**
+     * Returns whether the root value is complete.
+     *
+     * @return whether the parsing is done
+     */
+    inline auto isDone() const -> bool {
+        return state == State::Done;
+    }
+
+    /**
+     * Returns the amount of bytes consumed so far.
+     *
+     * @return the current position in the input
+     */
+    inline auto getPosition() const -> long long {
+        return offset;
+    }
+
+    /**
+     * @brief Signals the end of the data.
+     *
+     * The errors are the same as the ones of a @c Reader given the whole data.
+     * Afterwards, the reader can be reused for the next document.
+     *
+     * @throws Exception if the root value is incomplete
+     */
+    inline void finish() {
+        if (lexeme == Lexeme::Token) {
+            // The end of the data terminates the pending token.
+            endToken(pending);
+            pending.clear();
+        }
+        if (state != State::Done) {
+            char expected;
+            if (lexeme == Lexeme::String || lexeme == Lexeme::Key) {
+                expected = '"';
+            } else {
+                switch (state) {
+                    case State::Root:  expected = '{'; break;
+                    case State::Colon: expected = ':'; break;
+                    case State::Value: expected = '}'; break;
+
+                    case State::Element:
+                    case State::ElementEnd: expected = ']'; break;
+
+                    default: expected = '"'; break;
+                }
+            }
+            throw Exception(Error { ErrorCode::UnexpectedEnd, offset, expected, static_cast<char>(EOF) });
+        }
+        state  = State::Root;
+        offset = 0;
+    }
+};
+}
+
+#endif /* SimpleJSON_PushReader_hpp */
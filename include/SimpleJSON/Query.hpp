@@ -0,0 +1,245 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Query_hpp
+#define SimpleJSON_Query_hpp
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Cursor.hpp"
+#include "Value.hpp"
+
+namespace simple_json {
+/**
+ * The function the matching values of a query are passed to, together with
+ * the index of the matched path.
+ */
+using QueryConsumer = std::function<void(std::size_t path, Value& value)>;
+
+/**
+ * @brief Extracts the values at a set of paths from JSON data in one pass.
+ *
+ * The paths are compiled into a matcher, which is run while the data is
+ * scanned: subtrees no path leads into are skipped without creating any
+ * values, only the matching values are parsed.
+ *
+ * A path is either a JSON Pointer (RFC 6901), if it is empty or starts with
+ * a slash, or a wildcard path otherwise:
+ * @code
+ * /data/items/0/id     // JSON Pointer: the tokens match keys or array indices
+ * data.items[*].id     // Wildcard path: "*" matches every member or element
+ * data.*.tags[0]
+ * @endcode
+ * The parts of a wildcard path are separated by dots; array indices and the
+ * wildcard may also be written in square brackets, which are followed by a
+ * dot, another bracket or the end of the path. Parts consisting of digits
+ * only match array indices; such keys, as well as keys containing dots or
+ * brackets, can only be matched using JSON Pointers.
+ *
+ * Paths continuing into a matched value are matched on the parsed value, in
+ * which duplicate keys have been resolved like by @c parse.
+ *
+ * The parts of the data that are skipped are only checked for balanced
+ * brackets and terminated strings.
+ */
+class Query {
+    /** Indicates the absence of a node. */
+    static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    /**
+     * A state of the matcher: the common prefix of some paths.
+     */
+    struct Node {
+        /** The nodes following a matching key.                 */
+        std::vector<std::pair<std::string, std::size_t>> members;
+        /** The nodes following a matching array index.         */
+        std::vector<std::pair<std::size_t, std::size_t>> elements;
+        /** The node following any key or index, if any.        */
+        std::size_t any = none;
+        /** The indices of the paths ending at this node.       */
+        std::vector<std::size_t> paths;
+
+        /**
+         * Returns whether any path continues after this node.
+         *
+         * @return whether this node has successors
+         */
+        inline auto hasSuccessors() const -> bool {
+            return !members.empty() || !elements.empty() || any != none;
+        }
+    };
+
+    /** The nodes of the matcher, the first one is the root. */
+    std::vector<Node> nodes;
+    /** The amount of compiled paths.                        */
+    std::size_t count = 0;
+
+    /**
+     * Returns the successor of the given node for the given key, creating it
+     * if necessary.
+     *
+     * @param node the index of the node
+     * @param key the key
+     * @return the index of the successor
+     */
+    auto memberNode(std::size_t node, std::string key) -> std::size_t;
+
+    /**
+     * Returns the successor of the given node for the given array index,
+     * creating it if necessary.
+     *
+     * @param node the index of the node
+     * @param index the array index
+     * @return the index of the successor
+     */
+    auto elementNode(std::size_t node, std::size_t index) -> std::size_t;
+
+    /**
+     * Returns the successor of the given node for any key or index, creating
+     * it if necessary.
+     *
+     * @param node the index of the node
+     * @return the index of the successor
+     */
+    auto anyNode(std::size_t node) -> std::size_t;
+
+    /**
+     * @brief Compiles the given JSON Pointer.
+     *
+     * A token that is an array index matches both the key and the index, so
+     * the pointer may end at multiple nodes; at most one of them matches a
+     * given value.
+     *
+     * @param pointer the JSON Pointer
+     * @return the nodes the pointer ends at
+     * @throws Exception if the pointer is malformed, positioned in the pointer
+     */
+    auto compilePointer(std::string_view pointer) -> std::vector<std::size_t>;
+
+    /**
+     * Compiles the given wildcard path.
+     *
+     * @param path the path
+     * @return the node the path ends at
+     * @throws Exception if the path is malformed, positioned in the path
+     */
+    auto compilePath(std::string_view path) -> std::size_t;
+
+    /**
+     * Appends the successors of the given nodes for the given key.
+     *
+     * @param active the nodes
+     * @param name the key
+     * @param successors the nodes to append to
+     */
+    void memberSuccessors(const std::vector<std::size_t>& active, std::string_view name,
+                          std::vector<std::size_t>& successors) const;
+
+    /**
+     * Appends the successors of the given nodes for the given array index.
+     *
+     * @param active the nodes
+     * @param index the array index
+     * @param successors the nodes to append to
+     */
+    void elementSuccessors(const std::vector<std::size_t>& active, std::size_t index,
+                           std::vector<std::size_t>& successors) const;
+
+    /**
+     * Matches the given already parsed value and its nested values.
+     *
+     * @param value the value
+     * @param active the nodes matching the value
+     * @param consumer the function called with the matching values
+     */
+    void matchParsed(const Value& value, const std::vector<std::size_t>& active, const QueryConsumer& consumer) const;
+
+    /**
+     * @brief Matches the value at the current position of the given cursor.
+     *
+     * A matching value is parsed once; the paths continuing into it are
+     * matched on the parsed value instead of scanning it again.
+     *
+     * @param in the cursor
+     * @param active the nodes matching the value
+     * @param depth the nesting depth of the value
+     * @param levels the reusable node sets per nesting depth
+     * @param consumer the function called with the matching values
+     * @throws Exception if the parsing failed
+     */
+    void match(Cursor& in, const std::vector<std::size_t>& active, std::size_t depth,
+               std::vector<std::vector<std::size_t>>& levels, const QueryConsumer& consumer) const;
+
+public:
+    /**
+     * Compiles the given paths.
+     *
+     * @param paths the JSON Pointers or wildcard paths
+     * @throws Exception if a path is malformed, positioned in the path
+     */
+    explicit Query(const std::vector<std::string_view>& paths);
+
+    /**
+     * Returns the amount of compiled paths.
+     *
+     * @return the amount of paths
+     */
+    inline auto size() const -> std::size_t {
+        return count;
+    }
+
+    /**
+     * @brief Runs this query on the given JSON data.
+     *
+     * The matching values are passed to the consumer in the order of the
+     * data; a value matching multiple paths is passed once per path. The
+     * consumer may move the passed values.
+     *
+     * @param data the buffer containing the JSON data
+     * @param consumer the function called with the matching values
+     * @throws Exception if the parsing failed
+     */
+    void run(std::string_view data, const QueryConsumer& consumer) const;
+
+    /**
+     * Runs this query on the given JSON data and collects the matching values.
+     *
+     * @param data the buffer containing the JSON data
+     * @return the matching values of every path, in the order of the paths
+     * @throws Exception if the parsing failed
+     */
+    auto evaluate(std::string_view data) const -> std::vector<std::vector<Value>>;
+};
+
+/**
+ * Extracts the values at the given path from the given JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @param path the JSON Pointer or wildcard path
+ * @return the matching values in the order of the data
+ * @throws Exception if the path is malformed or the parsing failed
+ * @see Query
+ */
+static inline auto query(std::string_view data, std::string_view path) -> std::vector<Value> {
+    return std::move(Query({ path }).evaluate(data).front());
+}
+}
+
+#endif /* SimpleJSON_Query_hpp */
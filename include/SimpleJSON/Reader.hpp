@@ -0,0 +1,357 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Reader_hpp
+#define SimpleJSON_Reader_hpp
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+
+#include "Cursor.hpp"
+#include "Exception.hpp"
+#include "strings.hpp"
+
+namespace simple_json {
+/**
+ * @brief Parses JSON data and reports its content to a handler.
+ *
+ * No values are created: the parser calls the member functions of the
+ * handler for every parsed element. The handler needs to provide the
+ * following member functions:
+ * @code
+ * void startObject();
+ * void key(std::string_view name);
+ * void endObject();
+ * void startArray();
+ * void endArray();
+ * void string(std::string_view value);
+ * void integer(long value);
+ * void unsignedInteger(unsigned long value);
+ * void floating(double value);
+ * void boolean(bool value);
+ * void null();
+ * @endcode
+ * The views passed to @c key and @c string are only valid during the call.
+ * Strings without escape sequences are views into the parsed buffer. Numbers
+ * are reported to @c integer if they fit into a @c long , to
+ * @c unsignedInteger if they only fit into an @c unsigned @c long and to
+ * @c floating otherwise.
+ *
+ * @tparam Handler the type of the handler
+ */
+template<typename Handler>
+class Reader {
+    /** The cursor the data is read from.              */
+    Cursor& in;
+    /** The handler the parsed elements are reported to. */
+    Handler& handler;
+    /** The buffer for decoded strings.                */
+    std::string buffer;
+    /** The error if the parsing failed.               */
+    Error error {};
+    /** The current nesting depth.                     */
+    std::size_t depth = 0;
+
+    /**
+     * Reads a string surrounded by quotes.
+     *
+     * @param string set to a view of the decoded string
+     * @return whether a valid string was read
+     */
+    inline auto readString(std::string_view& string) -> bool {
+        bool escaped;
+        std::string_view raw;
+        if (!tryReadRawString(in, escaped, raw, error)) {
+            return false;
+        }
+        if (!escaped) {
+            string = raw;
+            return true;
+        }
+        buffer.resize(raw.size());
+        auto content = raw.data();
+        const auto last = strings::unescape(content, raw.data() + raw.size(), buffer.data());
+        if (last == nullptr) {
+            in.seek(content);
+            error = Error { ErrorCode::InvalidEscape, in.tellg() };
+            return false;
+        }
+        string = std::string_view(buffer.data(), static_cast<std::size_t>(last - buffer.data()));
+        return true;
+    }
+
+    /**
+     * Reads a primitive value.
+     *
+     * @return whether a value was read
+     */
+    inline auto readPrimitive() -> bool {
+        if (isNumberStart(in.peek())) {
+            numbers::Number number;
+            if (!tryReadNumber(in, number, error)) {
+                return false;
+            }
+            reportNumber(handler, number);
+            return true;
+        }
+        const auto start = in.tellg();
+        const auto first = in.peek();
+        const auto token = readToken(in);
+        if (token == "true") {
+            handler.boolean(true);
+        } else if (token == "false") {
+            handler.boolean(false);
+        } else if (token == "null") {
+            handler.null();
+        } else {
+            error = Error { ErrorCode::InvalidLiteral, start, '\0', static_cast<char>(first) };
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Reads any JSON value.
+     *
+     * @param closing the character closing the enclosing container
+     * @return whether a valid value was read
+     */
+    inline auto readValue(char closing) -> bool {
+        switch (in.peek()) {
+            case '"': {
+                std::string_view string;
+                if (!readString(string)) {
+                    return false;
+                }
+                handler.string(string);
+                return true;
+            }
+
+            case '[': return readArray();
+            case '{': return readObject();
+
+            case EOF:
+                error = unexpected(in, closing);
+                return false;
+
+            default: return readPrimitive();
+        }
+    }
+
+    /**
+     * Opens an array or object, whose opening bracket is consumed.
+     *
+     * @return whether the maximum depth is not exceeded
+     */
+    inline auto open() -> bool {
+        if (++depth > maxDepth) {
+            error = Error { ErrorCode::TooDeep, in.tellg() };
+            return false;
+        }
+        in.get();
+        return true;
+    }
+
+    /**
+     * @brief Reads a JSON array surrounded by square brackets.
+     *
+     * JSON arrays may contain any kind of JSON value, including a mixture of types.
+     *
+     * @return whether a valid array was read
+     */
+    auto readArray() -> bool {
+        // Skips the opening bracket found by the caller.
+        if (!open()) {
+            return false;
+        }
+        handler.startArray();
+        skipWhitespaces(in);
+        while (in.peek() != ']') {
+            if (!readValue(']')) {
+                return false;
+            }
+            skipWhitespaces(in);
+            if (in.peek() == ',') {
+                in.get();
+                skipWhitespaces(in);
+            }
+        }
+        in.get();
+        --depth;
+        handler.endArray();
+        return true;
+    }
+
+    /**
+     * Reads a JSON object surrounded by curly brackets.
+     *
+     * @return whether a valid object was read
+     */
+    auto readObject() -> bool {
+        // Skips the opening bracket found by the caller.
+        if (!open()) {
+            return false;
+        }
+        handler.startObject();
+        skipWhitespaces(in);
+        while (in.peek() != '}') {
+            std::string_view name;
+            if (!readString(name)) {
+                return false;
+            }
+            handler.key(name);
+            if (!tryExpectConsume(in, ':', error)) {
+                return false;
+            }
+            skipWhitespaces(in);
+            if (!readValue('}')) {
+                return false;
+            }
+            skipWhitespaces(in);
+            if (in.peek() == ',') {
+                in.get();
+                skipWhitespaces(in);
+            }
+        }
+        in.get();
+        --depth;
+        handler.endObject();
+        return true;
+    }
+
+public:
+    /** The maximum nesting depth of arrays and objects. */
+    static constexpr std::size_t maxDepth = 1024;
+
+    /**
+     * Constructs a reader reporting the data of the given cursor to the given handler.
+     *
+     * @param in the cursor to read from
+     * @param handler the handler
+     */
+    inline Reader(Cursor& in, Handler& handler): in(in), handler(handler) {}
+
+    /**
+     * @brief Parses a JSON object or array without throwing.
+     *
+     * If the parsing fails, the error is available using @c getError() .
+     * Exceptions thrown by the handler are passed on. Arrays and objects
+     * nested deeper than @c maxDepth are rejected.
+     *
+     * @return whether the parsing succeeded
+     */
+    inline auto tryParse() -> bool {
+        depth = 0;
+        skipWhitespaces(in);
+
+        switch (in.peek()) {
+            case '{': return readObject();
+            case '[': return readArray();
+
+            default:
+                error = unexpected(in, '{');
+                return false;
+        }
+    }
+
+    /**
+     * Parses any JSON value without throwing.
+     *
+     * @return whether the parsing succeeded
+     * @see tryParse()
+     */
+    inline auto tryParseValue() -> bool {
+        depth = 0;
+        skipWhitespaces(in);
+        return readValue('}');
+    }
+
+    /**
+     * Parses a JSON object or array.
+     *
+     * @throws Exception if the parsing failed
+     */
+    inline void parse() {
+        if (!tryParse()) {
+            throw Exception(error);
+        }
+    }
+
+    /**
+     * Parses any JSON value.
+     *
+     * @throws Exception if the parsing failed
+     */
+    inline void parseValue() {
+        if (!tryParseValue()) {
+            throw Exception(error);
+        }
+    }
+
+    /**
+     * Returns the error of the most recent failed parse.
+     *
+     * @return the error
+     */
+    inline auto getError() const -> const Error& {
+        return error;
+    }
+};
+
+/**
+ * Parses the given buffer and reports its content to the given handler.
+ *
+ * @param data the buffer containing the JSON data
+ * @param handler the handler
+ * @tparam Handler the type of the handler
+ * @throws Exception if the parsing failed
+ */
+template<typename Handler>
+inline void parse(std::string_view data, Handler& handler) {
+    auto in = Cursor(data);
+    Reader<Handler>(in, handler).parse();
+}
+
+/**
+ * @brief Parses the remaining content of the given input stream and reports
+ * it to the given handler.
+ *
+ * The remaining content of a seekable stream is read at once, afterwards the
+ * stream is positioned behind the parsed value. Other streams, such as pipes
+ * and sockets, are read incrementally up to the end of the value, so the
+ * data following it remains in the stream.
+ *
+ * @param stream the input stream to read the JSON data from
+ * @param handler the handler
+ * @tparam Handler the type of the handler
+ * @throws Exception if the parsing failed
+ */
+template<typename Handler>
+inline void parse(std::istream& stream, Handler& handler) {
+    const auto start = static_cast<long long>(stream.tellg());
+    const auto buffer = readValueData(stream);
+
+    auto in = Cursor(buffer, start < 0 ? 0 : start);
+    Reader<Handler>(in, handler).parse();
+    if (start >= 0) {
+        stream.clear();
+        stream.seekg(start + static_cast<long long>(in.consumed()));
+    }
+}
+}
+
+#endif /* SimpleJSON_Reader_hpp */
@@ -0,0 +1,137 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Result_hpp
+#define SimpleJSON_Result_hpp
+
+#include <utility>
+#include <variant>
+
+#include "Error.hpp"
+#include "Exception.hpp"
+
+namespace simple_json {
+/**
+ * @brief Contains either a value or the error that prevented its creation.
+ *
+ * Modeled after @c std::expected : the value is accessed using @c value() ,
+ * which throws the @c Exception of the error if there is no value, or
+ * unchecked using the dereference operators.
+ *
+ * @tparam T the type of the value
+ */
+template<typename T>
+class Result {
+    /** The value or the error. */
+    std::variant<T, Error> content;
+
+public:
+    /**
+     * Constructs a result containing the given value.
+     *
+     * @param value the value
+     */
+    inline Result(T value): content(std::in_place_index<0>, std::move(value)) {}
+
+    /**
+     * Constructs a result containing the given error.
+     *
+     * @param error the error
+     */
+    inline Result(const Error& error): content(std::in_place_index<1>, error) {}
+
+    /**
+     * Returns whether this result contains a value.
+     *
+     * @return whether a value is contained
+     */
+    inline auto hasValue() const -> bool {
+        return content.index() == 0;
+    }
+
+    inline explicit operator bool() const {
+        return hasValue();
+    }
+
+    /**
+     * @brief Returns the contained value.
+     *
+     * Throws the @c Exception of the contained error if there is no value.
+     *
+     * @return the contained value
+     */
+    inline auto value() & -> T& {
+        if (!hasValue()) {
+            throw Exception(error());
+        }
+        return *std::get_if<0>(&content);
+    }
+
+    /**
+     * @brief Returns the contained value.
+     *
+     * Throws the @c Exception of the contained error if there is no value.
+     *
+     * @return the contained value
+     */
+    inline auto value() const& -> const T& {
+        if (!hasValue()) {
+            throw Exception(error());
+        }
+        return *std::get_if<0>(&content);
+    }
+
+    /**
+     * @brief Moves the contained value out of this result.
+     *
+     * Throws the @c Exception of the contained error if there is no value.
+     *
+     * @return the contained value
+     */
+    inline auto value() && -> T {
+        if (!hasValue()) {
+            throw Exception(error());
+        }
+        return std::move(*std::get_if<0>(&content));
+    }
+
+    /**
+     * Returns the contained value or the given one if there is no value.
+     *
+     * @param fallback the value returned if there is no value
+     * @return the contained or the given value
+     */
+    inline auto valueOr(T fallback) const& -> T {
+        return hasValue() ? *std::get_if<0>(&content) : std::move(fallback);
+    }
+
+    inline auto operator*()        & -> T&       { return *std::get_if<0>(&content);           }
+    inline auto operator*()  const & -> const T& { return *std::get_if<0>(&content);           }
+    inline auto operator*()       && -> T        { return std::move(*std::get_if<0>(&content)); }
+    inline auto operator->()         -> T*       { return std::get_if<0>(&content);            }
+    inline auto operator->() const   -> const T* { return std::get_if<0>(&content);            }
+
+    /**
+     * Returns the contained error. Must only be called if there is no value.
+     *
+     * @return the contained error
+     */
+    inline auto error() const -> const Error& {
+        return *std::get_if<1>(&content);
+    }
+};
+}
+
+#endif /* SimpleJSON_Result_hpp */
@@ -0,0 +1,229 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Shared_hpp
+#define SimpleJSON_Shared_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace simple_json {
+/**
+ * @brief A reference-counted, copy-on-write holder of a payload.
+ *
+ * Copies share the payload in constant time. The payload is cloned when it is
+ * mutated while being shared, so every holder observes value semantics.
+ * Shared payloads may be read concurrently from multiple threads.
+ *
+ * Once references into the payload are handed out for writing, the payload
+ * is no longer shared: copies of the holder copy it, until the references are
+ * known to be invalid.
+ *
+ * Payloads whose allocator would not be used by copies of it (for instance
+ * payloads allocated inside of an @c Arena ) are never shared, but copied.
+ *
+ * An empty holder does not allocate any payload.
+ *
+ * @tparam T the type of the payload, constructible from an allocator
+ * @tparam Allocator the allocator to be used
+ */
+template<typename T, typename Allocator>
+class Shared {
+    /**
+     * The node containing the payload together with its reference count.
+     */
+    struct Node {
+        /** The amount of holders sharing this node.   */
+        std::atomic<std::size_t> references;
+        /** Whether the payload may be shared.         */
+        bool shareable = true;
+        /** The actual payload.                        */
+        T payload;
+
+        template<typename... Args>
+        inline explicit Node(Args&&... args): references(1), payload(std::forward<Args>(args)...) {}
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using Traits        = std::allocator_traits<NodeAllocator>;
+
+    /** The allocator used for the node.                     */
+    NodeAllocator allocator;
+    /** The node holding the payload, @c nullptr if empty.   */
+    Node* node = nullptr;
+
+    /**
+     * Creates a new node using the allocator of this holder.
+     *
+     * @param args the arguments to construct the payload with
+     * @return the new node
+     */
+    template<typename... Args>
+    inline auto create(Args&&... args) -> Node* {
+        const auto toReturn = Traits::allocate(allocator, 1);
+        try {
+            Traits::construct(allocator, toReturn, std::forward<Args>(args)...);
+        } catch (...) {
+            Traits::deallocate(allocator, toReturn, 1);
+            throw;
+        }
+        return toReturn;
+    }
+
+    /**
+     * Drops the reference to the node, destroying it if it was the last one.
+     */
+    inline void release() noexcept {
+        // A node referenced only by this holder cannot gain references concurrently.
+        if (node != nullptr && (node->references.load(std::memory_order_acquire) == 1
+                                || node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)) {
+            Traits::destroy(allocator, node);
+            Traits::deallocate(allocator, node, 1);
+        }
+        node = nullptr;
+    }
+
+public:
+    Shared() = default;
+
+    /**
+     * Constructs an empty holder using the given allocator.
+     *
+     * @param allocator the allocator
+     */
+    inline explicit Shared(const Allocator& allocator): allocator(allocator) {}
+
+    /**
+     * Shares the payload of the given holder, or copies it if the payload
+     * cannot be shared.
+     *
+     * @param other the holder to copy
+     */
+    inline Shared(const Shared& other): allocator(Traits::select_on_container_copy_construction(other.allocator)) {
+        if (other.node == nullptr) {
+            return;
+        }
+        if (allocator == other.allocator && other.node->shareable) {
+            node = other.node;
+            node->references.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            node = create(std::as_const(other.node->payload));
+        }
+    }
+
+    inline Shared(Shared&& other) noexcept: allocator(other.allocator), node(std::exchange(other.node, nullptr)) {}
+
+    inline ~Shared() {
+        release();
+    }
+
+    inline auto operator=(const Shared& other) -> Shared& {
+        if (this != &other) {
+            Shared(other).swap(*this);
+        }
+        return *this;
+    }
+
+    inline auto operator=(Shared&& other) noexcept -> Shared& {
+        Shared(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /**
+     * Swaps the payload of this holder with the one of the given holder.
+     *
+     * @param other the other holder
+     */
+    inline void swap(Shared& other) noexcept {
+        std::swap(allocator, other.allocator);
+        std::swap(node, other.node);
+    }
+
+    /**
+     * Returns the payload for reading.
+     *
+     * @return the payload or @c nullptr if this holder is empty
+     */
+    inline auto get() const noexcept -> const T* {
+        return node == nullptr ? nullptr : &node->payload;
+    }
+
+    /**
+     * @brief Returns the payload for writing.
+     *
+     * Creates the payload if this holder is empty and clones it if it is
+     * shared with other holders.
+     *
+     * @return the payload exclusively owned by this holder
+     */
+    inline auto mutate() -> T& {
+        if (node == nullptr) {
+            node = create(allocator);
+        } else if (node->references.load(std::memory_order_acquire) != 1) {
+            const auto copy = create(std::as_const(node->payload));
+            release();
+            node = copy;
+        }
+        return node->payload;
+    }
+
+    /**
+     * @brief Returns the payload for writing references into it.
+     *
+     * Like @c mutate() , but the caller may keep references into the payload:
+     * copies of this holder copy the payload instead of sharing it, so they
+     * cannot be changed through these references.
+     *
+     * @return the payload exclusively owned by this holder
+     */
+    inline auto expose() -> T& {
+        auto& payload = mutate();
+        node->shareable = false;
+        return payload;
+    }
+
+    /**
+     * Allows sharing the payload again. Must only be called once no reference
+     * returned by @c expose() is used anymore.
+     */
+    inline void share() noexcept {
+        if (node != nullptr) {
+            node->shareable = true;
+        }
+    }
+
+    /**
+     * Returns whether the payload is shared with other holders.
+     *
+     * @return whether the payload is shared
+     */
+    inline auto isShared() const noexcept -> bool {
+        return node != nullptr && node->references.load(std::memory_order_acquire) != 1;
+    }
+
+    /**
+     * Returns the allocator of this holder.
+     *
+     * @return the allocator
+     */
+    inline auto getAllocator() const -> Allocator {
+        return allocator;
+    }
+};
+}
+
+#endif /* SimpleJSON_Shared_hpp */
@@ -22,11 +22,30 @@
  * This header includes all parts of the API of SimpleJSON.
  */
 
+#include "Binding.hpp"
+#include "Compact.hpp"
+#include "Document.hpp"
+#include "Error.hpp"
 #include "Exception.hpp"
+#include "Lazy.hpp"
+#include "MappedFile.hpp"
 #include "Object.hpp"
+#include "ObjectView.hpp"
+#include "Parallel.hpp"
 #include "parser.hpp"
+#include "PushParser.hpp"
+#include "PushReader.hpp"
+#include "Query.hpp"
+#include "Reader.hpp"
+#include "Result.hpp"
+#include "Stats.hpp"
+#include "Tape.hpp"
+#include "ThreadPool.hpp"
 #include "Trait.hpp"
+#include "Validator.hpp"
 #include "Value.hpp"
+#include "ValueStream.hpp"
 #include "ValueType.hpp"
+#include "Writer.hpp"
 
 #endif /* SimpleJSON_SimpleJSON_hpp */
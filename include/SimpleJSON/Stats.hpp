@@ -0,0 +1,93 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Stats_hpp
+#define SimpleJSON_Stats_hpp
+
+/**
+ * @file Stats.hpp
+ *
+ * The instrumentation of the parser. It is only available if the macro
+ * @c SIMPLE_JSON_STATS is defined for the library as well as for the code
+ * using it; otherwise, nothing of it is compiled.
+ */
+
+#ifdef SIMPLE_JSON_STATS
+# include <array>
+# include <chrono>
+# include <cstddef>
+
+# include "ValueType.hpp"
+
+namespace simple_json {
+/**
+ * @brief The statistics of a parse.
+ *
+ * The time spent in the parser is split into the time of scanning the data
+ * and the time of building the values; the measuring itself adds to the
+ * total time of an instrumented parse.
+ */
+struct ParseStats {
+    /** The amount of consumed bytes.                                     */
+    std::size_t bytes = 0;
+    /** The amount of values per type, indexed by the @c ValueType .      */
+    std::array<std::size_t, 8> values {};
+    /** The maximum nesting depth of arrays and objects.                  */
+    std::size_t maxDepth = 0;
+    /** The amount of decoded bytes of the strings and keys.              */
+    std::size_t stringBytes = 0;
+    /** The amount of escape sequences in the strings and keys.           */
+    std::size_t escapes = 0;
+    /** The amount of allocations of the built values.                    */
+    std::size_t allocations = 0;
+    /** The amount of bytes allocated for the built values.               */
+    std::size_t allocatedBytes = 0;
+    /** The time spent scanning the data.                                 */
+    std::chrono::nanoseconds scanTime {};
+    /** The time spent building the values.                               */
+    std::chrono::nanoseconds buildTime {};
+
+    /**
+     * Returns the amount of parsed values of the given type.
+     *
+     * @param type the type of the values
+     * @return the amount of values
+     */
+    inline auto count(ValueType type) const -> std::size_t {
+        return values[static_cast<std::size_t>(type)];
+    }
+};
+
+namespace stats {
+/** The statistics allocations are counted for on this thread, if any. */
+extern thread_local ParseStats* current;
+
+/**
+ * Counts an allocation of the given size if the current thread collects
+ * statistics.
+ *
+ * @param size the amount of allocated bytes
+ */
+static inline void countAllocation(std::size_t size) {
+    if (current != nullptr) {
+        ++current->allocations;
+        current->allocatedBytes += size;
+    }
+}
+}
+}
+#endif
+
+#endif /* SimpleJSON_Stats_hpp */
@@ -0,0 +1,514 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Tape_hpp
+#define SimpleJSON_Tape_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "ValueType.hpp"
+
+namespace simple_json {
+class ValueRef;
+
+/**
+ * @brief Represents parsed JSON data as a flat tape.
+ *
+ * Each JSON value is represented by one 64 bit entry of the tape: the upper
+ * eight bits contain the type, the remaining bits the payload. Numbers are
+ * followed by an entry containing their value. Strings refer to their content
+ * in the string buffer of the tape. Arrays and objects refer to their end
+ * entry, which contains the amount of their elements, allowing them to be
+ * skipped at once.
+ *
+ * The contained data is accessed using the lightweight cursors @c ValueRef ,
+ * @c ArrayRef and @c ObjectRef , which must not outlive the tape.
+ */
+class Tape {
+    friend class TapeWriter;
+    friend class ValueRef;
+    friend class ArrayRef;
+    friend class ObjectRef;
+
+    /** The type stored in the entries marking the end of an array or object. */
+    static constexpr std::uint64_t endMarker = 0xff;
+    /** The amount of bits the type is shifted in an entry.                   */
+    static constexpr int typeShift = 56;
+
+    /** The entries of the tape.                         */
+    std::vector<std::uint64_t> entries;
+    /** The length prefixed contents of the strings.     */
+    std::string strings;
+
+    /**
+     * Parses the given JSON data into this tape.
+     *
+     * @param data the JSON data
+     * @throws Exception if the parsing failed
+     */
+    void parse(std::string_view data);
+
+    /**
+     * Returns the payload of the entry at the given index.
+     *
+     * @param index the index of the entry
+     * @return the payload of the entry
+     */
+    inline auto payload(std::size_t index) const -> std::uint64_t {
+        return entries[index] & ((std::uint64_t(1) << typeShift) - 1);
+    }
+
+    /**
+     * Returns the string stored at the given offset in the string buffer.
+     *
+     * @param offset the offset of the string
+     * @return the string
+     */
+    inline auto string(std::size_t offset) const -> std::string_view {
+        std::uint32_t length;
+        std::memcpy(&length, strings.data() + offset, sizeof(length));
+        return std::string_view(strings.data() + offset + sizeof(length), length);
+    }
+
+public:
+    /**
+     * Parses the given buffer into a tape.
+     *
+     * @param data the buffer containing the JSON data
+     * @throws Exception if the parsing failed
+     */
+    explicit Tape(std::string_view data);
+
+    /**
+     * @brief Parses the remaining content of the given input stream into a tape.
+     *
+     * The stream is read to its end, including any data following the value.
+     *
+     * @param stream the input stream to read the JSON data from
+     * @throws Exception if the parsing failed
+     */
+    explicit Tape(std::istream& stream);
+
+    /**
+     * Returns the parsed root value.
+     *
+     * @return a cursor to the root value
+     */
+    inline auto getRoot() const -> ValueRef;
+};
+
+class ArrayRef;
+class ObjectRef;
+
+/**
+ * @brief A cursor to a JSON value stored in a @c Tape .
+ *
+ * Offers the same accessors as @c Value . Arrays are returned as @c ArrayRef ,
+ * objects as @c ObjectRef and strings as @c std::string_view .
+ */
+class ValueRef {
+    friend class ArrayRef;
+    friend class ObjectRef;
+
+    /** The tape containing the value.  */
+    const Tape* tape;
+    /** The index of the value entry.   */
+    std::size_t index;
+
+    /**
+     * Returns the index of the entry following this value.
+     *
+     * @return the index of the next entry
+     */
+    inline auto next() const -> std::size_t {
+        switch (getType()) {
+            case ValueType::Int:
+            case ValueType::UInt:
+            case ValueType::Double:
+                return index + 2;
+
+            case ValueType::Array:
+            case ValueType::Object:
+                return static_cast<std::size_t>(tape->payload(index)) + 1;
+
+            default: return index + 1;
+        }
+    }
+
+public:
+    /**
+     * Constructs a cursor to the value at the given index.
+     *
+     * @param tape the tape containing the value
+     * @param index the index of the value entry
+     */
+    constexpr inline ValueRef(const Tape* tape, std::size_t index): tape(tape), index(index) {}
+
+    /**
+     * Returns the type of the referred value.
+     *
+     * @return the type of the value
+     */
+    inline auto getType() const -> ValueType {
+        return static_cast<ValueType>(tape->entries[index] >> Tape::typeShift);
+    }
+
+    /**
+     * Returns whether the type of the referred value is equal to the given type.
+     *
+     * @param type the type to compare against
+     * @return whether the types match
+     */
+    inline auto is(ValueType type) const -> bool {
+        return getType() == type;
+    }
+
+    /**
+     * @brief Returns the referred value casted as the given type.
+     *
+     * Throws an exception if the referred value is not of the given type.
+     *
+     * @tparam T the value type to cast the referred value to
+     * @return the casted value
+     */
+    template<ValueType T>
+    inline auto as() const;
+};
+
+/**
+ * A cursor to a JSON array stored in a @c Tape .
+ */
+class ArrayRef {
+    /** The tape containing the array.        */
+    const Tape* tape;
+    /** The index of the array start entry.   */
+    std::size_t index;
+
+public:
+    /**
+     * An iterator over the elements of an array.
+     */
+    class Iterator {
+        /** The current element. */
+        ValueRef current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = ValueRef;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const ValueRef*;
+        using reference         = const ValueRef&;
+
+        /**
+         * Constructs an iterator pointing to the given element.
+         *
+         * @param current the element
+         */
+        constexpr inline Iterator(ValueRef current): current(current) {}
+
+        inline auto operator*() const -> reference { return current; }
+        inline auto operator->() const -> pointer { return &current; }
+
+        inline auto operator++() -> Iterator& {
+            current.index = current.next();
+            return *this;
+        }
+
+        inline auto operator++(int) -> Iterator {
+            auto toReturn = *this;
+            ++*this;
+            return toReturn;
+        }
+
+        inline auto operator==(const Iterator& other) const -> bool { return current.index == other.current.index; }
+        inline auto operator!=(const Iterator& other) const -> bool { return current.index != other.current.index; }
+    };
+
+    /**
+     * Constructs a cursor to the array starting at the given index.
+     *
+     * @param tape the tape containing the array
+     * @param index the index of the array start entry
+     */
+    constexpr inline ArrayRef(const Tape* tape, std::size_t index): tape(tape), index(index) {}
+
+    /**
+     * Returns the amount of elements in the array.
+     *
+     * @return the amount of elements
+     */
+    inline auto size() const -> std::size_t {
+        return static_cast<std::size_t>(tape->payload(static_cast<std::size_t>(tape->payload(index))));
+    }
+
+    /**
+     * Returns whether the array is empty.
+     *
+     * @return whether there are no elements
+     */
+    inline auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    inline auto begin() const -> Iterator { return ValueRef(tape, index + 1); }
+    inline auto end() const -> Iterator { return ValueRef(tape, static_cast<std::size_t>(tape->payload(index))); }
+
+    /**
+     * @brief Returns the element at the given position.
+     *
+     * The elements are not indexed, the access takes linear time.
+     *
+     * @param position the position of the element
+     * @return the element
+     */
+    inline auto operator[](std::size_t position) const -> ValueRef {
+        auto it = begin();
+        while (position-- > 0) {
+            ++it;
+        }
+        return *it;
+    }
+};
+
+/**
+ * @brief A cursor to a JSON object stored in a @c Tape .
+ *
+ * Offers the same accessors as @c Object . Members are searched linearly;
+ * like for @c Object , the last of duplicated keys wins.
+ */
+class ObjectRef {
+    /** The tape containing the object.       */
+    const Tape* tape;
+    /** The index of the object start entry.  */
+    std::size_t index;
+
+public:
+    /**
+     * An iterator over the members of an object.
+     */
+    class Iterator {
+        /** The tape containing the object.       */
+        const Tape* tape;
+        /** The index of the current key entry.   */
+        std::size_t index;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<std::string_view, ValueRef>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        /**
+         * Constructs an iterator pointing to the member at the given index.
+         *
+         * @param tape the tape containing the object
+         * @param index the index of the key entry of the member
+         */
+        constexpr inline Iterator(const Tape* tape, std::size_t index): tape(tape), index(index) {}
+
+        inline auto operator*() const -> reference {
+            return { tape->string(static_cast<std::size_t>(tape->payload(index))), ValueRef(tape, index + 1) };
+        }
+
+        inline auto operator++() -> Iterator& {
+            index = ValueRef(tape, index + 1).next();
+            return *this;
+        }
+
+        inline auto operator++(int) -> Iterator {
+            auto toReturn = *this;
+            ++*this;
+            return toReturn;
+        }
+
+        inline auto operator==(const Iterator& other) const -> bool { return index == other.index; }
+        inline auto operator!=(const Iterator& other) const -> bool { return index != other.index; }
+    };
+
+    /**
+     * Constructs a cursor to the object starting at the given index.
+     *
+     * @param tape the tape containing the object
+     * @param index the index of the object start entry
+     */
+    constexpr inline ObjectRef(const Tape* tape, std::size_t index): tape(tape), index(index) {}
+
+    /**
+     * Returns the amount of members in the object.
+     *
+     * @return the amount of members
+     */
+    inline auto size() const -> std::size_t {
+        return static_cast<std::size_t>(tape->payload(static_cast<std::size_t>(tape->payload(index))));
+    }
+
+    /**
+     * Returns whether the object is empty.
+     *
+     * @return whether there are no members
+     */
+    inline auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    inline auto begin() const -> Iterator { return Iterator(tape, index + 1); }
+    inline auto end() const -> Iterator { return Iterator(tape, static_cast<std::size_t>(tape->payload(index))); }
+
+    /**
+     * Searches the value for the given key.
+     *
+     * @param name the key to search
+     * @return the value or @c std::nullopt if not found
+     */
+    inline auto find(std::string_view name) const -> std::optional<ValueRef> {
+        // The members cannot be iterated backwards, so the last occurrence is remembered.
+        std::optional<ValueRef> toReturn;
+        for (const auto& [key, value] : *this) {
+            if (key == name) {
+                toReturn = value;
+            }
+        }
+        return toReturn;
+    }
+
+    /**
+     * @brief Gets the contained value for the given key.
+     *
+     * Throws an exception if the value is found but the type does not match
+     * the given type.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the value for the given key or @c std::nullopt if not found or @c null
+     */
+    template<ValueType T>
+    inline auto get(std::string_view name) const -> std::optional<decltype(std::declval<ValueRef>().as<T>())> {
+        if (const auto value = find(name); value && !value->is(ValueType::Null)) {
+            return value->as<T>();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Gets the contained object for the given key.
+     *
+     * Throws an exception if the value is found but is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the object for the given key or @c std::nullopt if not found or @c null
+     */
+    inline auto getObject(std::string_view name) const -> std::optional<ObjectRef>;
+
+    /**
+     * @brief Returns the value referred to by the given key.
+     *
+     * Throws an exception if the value is not found or the type does not match.
+     *
+     * @param name the key whose mapped value to get
+     * @tparam T the value type enumeration value of the desired type
+     * @return the mapped value
+     */
+    template<ValueType T>
+    inline auto getBang(std::string_view name) const {
+        if (const auto value = find(name)) {
+            return value->as<T>();
+        }
+        throw std::out_of_range("simple_json::ObjectRef::getBang");
+    }
+
+    /**
+     * @brief Gets the object referred to by the given key.
+     *
+     * Throws an exception if the object is not found or is not a JSON object.
+     *
+     * @param name the key whose mapped object to get
+     * @return the mapped object
+     */
+    inline auto getObjectBang(std::string_view name) const -> ObjectRef;
+
+    /**
+     * @brief Gets the object referred to by the given key and casts it to the
+     * given type.
+     *
+     * Uses the functional style cast.
+     *
+     * @param name the key whose mapped object to get
+     * @tparam T the type to construct from the contained JSON object
+     * @return the mapped object casted to the given type or @c std::nullopt if not found or @c null
+     */
+    template<typename T>
+    inline auto maybeGetAs(std::string_view name) const -> std::optional<T> {
+        static_assert(std::is_constructible_v<T, ObjectRef>,
+                      "Given type must be constructible from simple_json::ObjectRef");
+
+        if (auto object = getObject(name)) {
+            return T(*object);
+        }
+        return std::nullopt;
+    }
+};
+
+inline auto Tape::getRoot() const -> ValueRef {
+    return ValueRef(this, 0);
+}
+
+template<ValueType T>
+inline auto ValueRef::as() const {
+    if (!is(T)) {
+        throw std::bad_variant_access();
+    }
+    if constexpr (T == ValueType::Int) {
+        return static_cast<long>(tape->entries[index + 1]);
+    } else if constexpr (T == ValueType::UInt) {
+        return static_cast<unsigned long>(tape->entries[index + 1]);
+    } else if constexpr (T == ValueType::Double) {
+        double toReturn;
+        std::memcpy(&toReturn, &tape->entries[index + 1], sizeof(toReturn));
+        return toReturn;
+    } else if constexpr (T == ValueType::String) {
+        return tape->string(static_cast<std::size_t>(tape->payload(index)));
+    } else if constexpr (T == ValueType::Bool) {
+        return tape->payload(index) != 0;
+    } else if constexpr (T == ValueType::Array) {
+        return ArrayRef(tape, index);
+    } else if constexpr (T == ValueType::Object) {
+        return ObjectRef(tape, index);
+    } else {
+        static_assert(T != ValueType::Null, "null values cannot be casted");
+    }
+}
+
+inline auto ObjectRef::getObject(std::string_view name) const -> std::optional<ObjectRef> {
+    return get<ValueType::Object>(name);
+}
+
+inline auto ObjectRef::getObjectBang(std::string_view name) const -> ObjectRef {
+    return getBang<ValueType::Object>(name);
+}
+}
+
+#endif /* SimpleJSON_Tape_hpp */
@@ -0,0 +1,129 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_ThreadPool_hpp
+#define SimpleJSON_ThreadPool_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simple_json {
+/**
+ * @brief A pool of threads executing submitted tasks.
+ *
+ * Every thread has its own queue of tasks. Tasks submitted by a task are
+ * queued on the queue of the executing thread, other tasks are distributed
+ * over the queues. A thread whose queue is empty steals the most recently
+ * queued task of another thread.
+ *
+ * Submitting and taking a task only locks the affected queue. Threads that
+ * find no task sleep; a sleeping thread is woken for a submitted task only
+ * if no other thread is searching for tasks.
+ */
+class ThreadPool {
+    /**
+     * The queue of tasks of a thread.
+     */
+    struct Queue {
+        /** The mutex protecting the tasks. */
+        std::mutex mutex;
+        /** The queued tasks.               */
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /** The queues of the threads.                                 */
+    std::vector<std::unique_ptr<Queue>> queues;
+    /** The threads.                                               */
+    std::vector<std::thread> threads;
+    /** The mutex the idle threads sleep on.                       */
+    std::mutex mutex;
+    /** The condition the idle threads wait for.                   */
+    std::condition_variable condition;
+    /** The amount of queued tasks, changed with the queue locked. */
+    std::atomic<std::size_t> queued = 0;
+    /** The amount of sleeping threads.                            */
+    std::atomic<std::size_t> idle = 0;
+    /** The amount of threads searching for a task.                */
+    std::atomic<std::size_t> searching = 0;
+    /** The queue receiving the next task submitted from outside.  */
+    std::atomic<std::size_t> next = 0;
+    /** Whether the pool is being destroyed, guarded by the mutex. */
+    bool stopping = false;
+
+    /**
+     * Takes a task, preferring the queue of the given thread.
+     *
+     * @param index the index of the taking thread
+     * @param task the task to be replaced by the taken one
+     * @return whether a task was taken
+     */
+    auto take(std::size_t index, std::function<void()>& task) -> bool;
+
+    /**
+     * Wakes one sleeping thread, if any.
+     */
+    void wake();
+
+    /**
+     * Executes the queued tasks until the pool is destroyed.
+     *
+     * @param index the index of the executing thread
+     */
+    void run(std::size_t index);
+
+public:
+    /**
+     * Starts the given amount of threads.
+     *
+     * @param threads the amount of threads, @c 0 for one per hardware thread
+     */
+    explicit ThreadPool(std::size_t threads = 0);
+
+    /**
+     * Executes the remaining tasks and stops the threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    /**
+     * @brief Queues the given task for execution.
+     *
+     * The task must not throw.
+     *
+     * @param task the task to be executed
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * Returns the amount of threads of this pool.
+     *
+     * @return the amount of threads
+     */
+    inline auto size() const -> std::size_t {
+        return threads.size();
+    }
+};
+}
+
+#endif /* SimpleJSON_ThreadPool_hpp */
@@ -16,19 +16,27 @@
 #ifndef SimpleJSON_Trait_hpp
 #define SimpleJSON_Trait_hpp
 
-#include <map>
 #include <string>
-#include <vector>
 
+#include "Arena.hpp"
+#include "ArrayContent.hpp"
+#include "ObjectContent.hpp"
 #include "ValueType.hpp"
 
 namespace simple_json {
 struct Value;
 
 /**
- * The type used for the content of a JSON object.
+ * The type used for the content of a JSON array. Copies share their elements
+ * until they are modified.
  */
-using ObjectContent = std::map<std::string, Value>;
+using ArrayContent = BasicArrayContent<Value, Allocator<Value>>;
+
+/**
+ * The type used for the content of a JSON object. Its members are kept in the
+ * order they were inserted. Copies share their members until they are modified.
+ */
+using ObjectContent = BasicObjectContent<Value, Allocator<Value>>;
 
 /**
  * This structure contains an @c using declaration for the value type represented
@@ -46,7 +54,7 @@ struct Trait<ValueType::Int> {
 
 template<>
 struct Trait<ValueType::Array> {
-    using Type = std::vector<Value>;
+    using Type = ArrayContent;
 };
 
 template<>
@@ -63,6 +71,16 @@ template<>
 struct Trait<ValueType::Object> {
     using Type = ObjectContent;
 };
+
+template<>
+struct Trait<ValueType::UInt> {
+    using Type = unsigned long;
+};
+
+template<>
+struct Trait<ValueType::Double> {
+    using Type = double;
+};
 }
 
 #endif /* SimpleJSON_Trait_hpp */
@@ -0,0 +1,439 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Validator_hpp
+#define SimpleJSON_Validator_hpp
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "Cursor.hpp"
+#include "Error.hpp"
+#include "Exception.hpp"
+#include "numbers.hpp"
+#include "scanner.hpp"
+#include "strings.hpp"
+
+namespace simple_json {
+/**
+ * A handler ignoring all elements, used to validate data without parsing it.
+ */
+struct NullHandler {
+    inline void startObject() {}
+    inline void key(std::string_view) {}
+    inline void endObject() {}
+    inline void startArray() {}
+    inline void endArray() {}
+    inline void string(std::string_view) {}
+    inline void integer(long) {}
+    inline void unsignedInteger(unsigned long) {}
+    inline void floating(double) {}
+    inline void boolean(bool) {}
+    inline void null() {}
+};
+
+/**
+ * Returns whether the given character is a hexadecimal digit.
+ *
+ * @param character the character
+ * @return whether the character is a digit or a letter from @c a to @c f in any case
+ */
+static inline auto isHexDigit(char character) -> bool {
+    return (character >= '0' && character <= '9')
+        || (character >= 'a' && character <= 'f')
+        || (character >= 'A' && character <= 'F');
+}
+
+/**
+ * Returns whether a valid escape sequence starts at the given backslash.
+ *
+ * @param begin the backslash
+ * @param end the end of the input
+ * @return whether the escape sequence is valid
+ */
+static inline auto isValidEscape(const char* begin, const char* end) -> bool {
+    if (end - begin < 2) {
+        return false;
+    }
+    switch (begin[1]) {
+        case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+            return true;
+
+        case 'u':
+            return end - begin >= 6 && isHexDigit(begin[2]) && isHexDigit(begin[3])
+                                    && isHexDigit(begin[4]) && isHexDigit(begin[5]);
+
+        default: return false;
+    }
+}
+
+/**
+ * @brief Validates JSON data strictly and reports its content to a handler.
+ *
+ * The data needs to be valid UTF-8 and conform to RFC 8259: unlike the
+ * @c Reader , missing and trailing commas, unescaped control characters in
+ * strings, characters following a number or literal and characters following
+ * the value are rejected. Any value is accepted at the root. Numbers are
+ * only checked against the grammar, their magnitude is not limited.
+ *
+ * The handler is called like by the @c Reader . With the @c NullHandler ,
+ * strings are not decoded and nothing is allocated. When reporting to another
+ * handler, numbers are converted like by the parser; as an extra restriction,
+ * numbers too large for a @c double are rejected with
+ * @c ErrorCode::InvalidNumber then, since they cannot be reported.
+ *
+ * @tparam Handler the type of the handler
+ */
+template<typename Handler = NullHandler>
+class Validator {
+    /** Whether the parsed elements are reported to a handler.   */
+    static constexpr bool reports = !std::is_same_v<Handler, NullHandler>;
+
+    /** The cursor the data is read from.                        */
+    Cursor& in;
+    /** The handler the parsed elements are reported to.         */
+    Handler& handler;
+    /** The buffer for decoded strings.                          */
+    std::string buffer;
+    /** The error if the validation failed.                      */
+    Error error {};
+    /** The current nesting depth.                               */
+    std::size_t depth = 0;
+
+    /**
+     * Sets the error to the given code at the given position.
+     *
+     * @param code the error code
+     * @param position the position of the error
+     * @return @c false
+     */
+    inline auto fail(ErrorCode code, const char* position) -> bool {
+        in.seek(position);
+        error = Error { code, in.tellg(), '\0', static_cast<char>(in.peek()) };
+        return false;
+    }
+
+    /**
+     * Reads a string surrounded by quotes, validating its escape sequences.
+     *
+     * @param string set to a view of the decoded string if reported
+     * @return whether a valid string was read
+     */
+    inline auto readString(std::string_view& string) -> bool {
+        if (!tryExpectConsume(in, '"', error, false)) {
+            return false;
+        }
+        const auto begin = in.position();
+        auto current = begin;
+        auto escaped = false;
+        for (;;) {
+            current = scanner::findEscapable(current, in.last());
+            if (current == in.last()) {
+                in.seek(current);
+                error = unexpected(in, '"');
+                return false;
+            }
+            if (*current == '"') {
+                break;
+            }
+            if (*current != '\\') {
+                return fail(ErrorCode::ControlCharacter, current);
+            }
+            if (!isValidEscape(current, in.last())) {
+                return fail(ErrorCode::InvalidEscape, current);
+            }
+            escaped = true;
+            current += current[1] == 'u' ? 6 : 2;
+        }
+        in.seek(current + 1);
+
+        if constexpr (reports) {
+            if (!escaped) {
+                string = std::string_view(begin, static_cast<std::size_t>(current - begin));
+                return true;
+            }
+            buffer.resize(static_cast<std::size_t>(current - begin));
+            auto content = begin;
+            const auto last = strings::unescape(content, current, buffer.data());
+            string = std::string_view(buffer.data(), static_cast<std::size_t>(last - buffer.data()));
+        }
+        return true;
+    }
+
+    /**
+     * Reads a number or a literal.
+     *
+     * @return whether a valid value was read
+     */
+    inline auto readPrimitive() -> bool {
+        if (isNumberStart(in.peek())) {
+            const auto end = numbers::skip(in.position(), in.last());
+            if (end == nullptr || (end < in.last() && !isDelimiter(*end))) {
+                error = Error { ErrorCode::InvalidNumber, in.tellg() };
+                return false;
+            }
+            if constexpr (reports) {
+                numbers::Number number;
+                if (!tryReadNumber(in, number, error)) {
+                    return false;
+                }
+                reportNumber(handler, number);
+            } else {
+                in.seek(end);
+            }
+            return true;
+        }
+        const auto start = in.position();
+        const auto token = readToken(in);
+        if (token == "true") {
+            handler.boolean(true);
+        } else if (token == "false") {
+            handler.boolean(false);
+        } else if (token == "null") {
+            handler.null();
+        } else {
+            return fail(ErrorCode::InvalidLiteral, start);
+        }
+        return true;
+    }
+
+    /**
+     * Reads any JSON value.
+     *
+     * @param closing the character closing the enclosing container
+     * @return whether a valid value was read
+     */
+    inline auto readValue(char closing) -> bool {
+        switch (in.peek()) {
+            case '"': {
+                std::string_view string;
+                if (!readString(string)) {
+                    return false;
+                }
+                handler.string(string);
+                return true;
+            }
+
+            case '[': return readArray();
+            case '{': return readObject();
+
+            case EOF:
+                error = unexpected(in, closing);
+                return false;
+
+            default: return readPrimitive();
+        }
+    }
+
+    /**
+     * Opens an array or object, whose opening bracket is consumed.
+     *
+     * @return whether the maximum depth is not exceeded
+     */
+    inline auto open() -> bool {
+        if (++depth > maxDepth) {
+            return fail(ErrorCode::TooDeep, in.position());
+        }
+        in.get();
+        return true;
+    }
+
+    /**
+     * Reads the separator following a value in an array or object.
+     *
+     * @param closing the character closing the container
+     * @param closed set to whether the container is closed
+     * @return whether a comma or the closing character was read
+     */
+    inline auto readSeparator(char closing, bool& closed) -> bool {
+        skipWhitespaces(in);
+        const auto next = in.peek();
+        if (next != ',' && next != closing) {
+            error = unexpected(in, closing);
+            return false;
+        }
+        in.get();
+        closed = next == closing;
+        if (!closed) {
+            skipWhitespaces(in);
+        }
+        return true;
+    }
+
+    /**
+     * Reads a JSON array surrounded by square brackets.
+     *
+     * @return whether a valid array was read
+     */
+    auto readArray() -> bool {
+        if (!open()) {
+            return false;
+        }
+        handler.startArray();
+        skipWhitespaces(in);
+        auto closed = in.peek() == ']';
+        if (closed) {
+            in.get();
+        }
+        while (!closed) {
+            if (!readValue(']') || !readSeparator(']', closed)) {
+                return false;
+            }
+        }
+        --depth;
+        handler.endArray();
+        return true;
+    }
+
+    /**
+     * Reads a JSON object surrounded by curly brackets.
+     *
+     * @return whether a valid object was read
+     */
+    auto readObject() -> bool {
+        if (!open()) {
+            return false;
+        }
+        handler.startObject();
+        skipWhitespaces(in);
+        auto closed = in.peek() == '}';
+        if (closed) {
+            in.get();
+        }
+        while (!closed) {
+            std::string_view name;
+            if (!readString(name)) {
+                return false;
+            }
+            handler.key(name);
+            if (!tryExpectConsume(in, ':', error)) {
+                return false;
+            }
+            skipWhitespaces(in);
+            if (!readValue('}') || !readSeparator('}', closed)) {
+                return false;
+            }
+        }
+        --depth;
+        handler.endObject();
+        return true;
+    }
+
+    /**
+     * Reads the value and checks that only whitespaces follow it.
+     *
+     * @return whether the data is valid
+     */
+    inline auto readDocument() -> bool {
+        skipWhitespaces(in);
+        if (!readValue('{')) {
+            return false;
+        }
+        skipWhitespaces(in);
+        if (in.peek() != EOF) {
+            return fail(ErrorCode::TrailingCharacters, in.position());
+        }
+        return true;
+    }
+
+public:
+    /** The maximum nesting depth of arrays and objects. */
+    static constexpr std::size_t maxDepth = 1024;
+
+    /**
+     * Constructs a validator reporting the data of the given cursor to the given handler.
+     *
+     * @param in the cursor to read from
+     * @param handler the handler
+     */
+    inline Validator(Cursor& in, Handler& handler): in(in), handler(handler) {}
+
+    /**
+     * @brief Validates the remaining data of the cursor without throwing.
+     *
+     * The encoding is validated before the grammar. If the data is not valid
+     * UTF-8, the valid part in front of the invalid sequence is checked for an
+     * earlier error of the grammar, so the first error of the data is reported.
+     * The elements of the data may be reported to the handler before an error
+     * is found.
+     *
+     * @return whether the data is valid
+     */
+    inline auto tryValidate() -> bool {
+        const auto invalid = scanner::validateUtf8(in.position(), in.last());
+        if (invalid == in.last()) {
+            return readDocument();
+        }
+        const auto position = in.tellg() + (invalid - in.position());
+        auto valid     = Cursor(std::string_view(in.position(), static_cast<std::size_t>(invalid - in.position())), in.tellg());
+        auto validator = Validator(valid, handler);
+        if (!validator.readDocument() && validator.error.position < position) {
+            error = validator.error;
+            in.seek(valid.position());
+        } else {
+            in.seek(invalid);
+            error = Error { ErrorCode::InvalidUtf8, position, '\0', *invalid };
+        }
+        return false;
+    }
+
+    /**
+     * Validates the remaining data of the cursor.
+     *
+     * @throws Exception if the data is invalid
+     */
+    inline void validate() {
+        if (!tryValidate()) {
+            throw Exception(error);
+        }
+    }
+
+    /**
+     * Returns the error of the most recent failed validation.
+     *
+     * @return the error
+     */
+    inline auto getError() const -> const Error& {
+        return error;
+    }
+};
+
+/**
+ * @brief Validates the given JSON data strictly.
+ *
+ * Checks the UTF-8 encoding and the grammar of RFC 8259 without allocating.
+ *
+ * @param data the JSON data
+ * @return the first error of the data or @c std::nullopt if it is valid
+ * @see Validator
+ */
+auto validate(std::string_view data) -> std::optional<Error>;
+
+/**
+ * Returns whether the given JSON data is strictly valid.
+ *
+ * @param data the JSON data
+ * @return whether the data is valid
+ * @see validate(std::string_view)
+ */
+static inline auto isValid(std::string_view data) -> bool {
+    return !validate(data).has_value();
+}
+}
+
+#endif /* SimpleJSON_Validator_hpp */
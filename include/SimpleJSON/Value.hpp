@@ -16,13 +16,23 @@
 #ifndef SimpleJSON_Value_hpp
 #define SimpleJSON_Value_hpp
 
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 #include "Trait.hpp"
 
 namespace simple_json {
 /**
- * Represents a JSON value.
+ * @brief Represents a JSON value.
+ *
+ * The strings of the values of a @c Document are borrowed from the document
+ * instead of being contained as @c std::string ; they are accessed using
+ * @c asStringView() . Copies of a value always own their strings, so they are
+ * independent of any document.
  */
 struct Value {
     /** The type of the contained value. */
@@ -33,24 +43,142 @@ struct Value {
         Trait<ValueType::Array>::Type,
         Trait<ValueType::String>::Type,
         Trait<ValueType::Bool>::Type,
-        Trait<ValueType::Object>::Type
+        Trait<ValueType::Object>::Type,
+        std::string_view,
+        Trait<ValueType::UInt>::Type,
+        Trait<ValueType::Double>::Type
     > value;
 
+    Value() = default;
+
+    /**
+     * Constructs a value of the given type.
+     *
+     * @param type the type of the value
+     * @param value the contained value
+     */
+    template<typename T>
+    inline Value(ValueType type, T&& value): type(type), value(std::forward<T>(value)) {}
+
     /**
-     * @brief Returns the contained value casted as the given type.
+     * Copies the given value. Borrowed strings are copied into owned ones.
+     *
+     * @param other the value to copy
+     */
+    inline Value(const Value& other): type(other.type), value(other.value) {
+        own();
+    }
+
+    Value(Value&&) noexcept = default;
+
+    inline auto operator=(const Value& other) -> Value& {
+        if (this != &other) {
+            type  = other.type;
+            value = other.value;
+            own();
+        }
+        return *this;
+    }
+
+    auto operator=(Value&&) noexcept -> Value& = default;
+
+    /**
+     * Replaces a borrowed string by an owned copy of it.
+     */
+    inline void own() {
+        if (const auto view = std::get_if<std::string_view>(&value)) {
+            value = Trait<ValueType::String>::Type(*view);
+        }
+    }
+
+    /**
+     * @brief Returns a reference to the contained value casted as the given type.
      *
      * Throws an exception if the contained value is not of the given type.
      * Consider checking the type (for instance with @c is(ValueType)) before
      * casting.
      *
+     * Since no @c std::string exists for the borrowed strings of a
+     * @c Document , @c std::bad_variant_access is thrown for them; strings of
+     * any value are accessed using @c asStringView() .
+     *
      * @tparam T the value type to cast the contained value to
      * @return the casted value
      */
     template<ValueType T>
-    constexpr inline auto as() const {
+    constexpr inline auto as() const& -> const typename Trait<T>::Type& {
         return std::get<typename Trait<T>::Type>(value);
     }
 
+    /**
+     * @brief Moves the contained value casted as the given type out of this value.
+     *
+     * Throws an exception if the contained value is not of the given type.
+     * Consider checking the type (for instance with @c is(ValueType)) before
+     * casting. Borrowed strings are copied.
+     *
+     * @tparam T the value type to cast the contained value to
+     * @return the casted value
+     */
+    template<ValueType T>
+    constexpr inline auto as() && -> typename Trait<T>::Type {
+        if constexpr (T == ValueType::String) {
+            if (const auto view = std::get_if<std::string_view>(&value)) {
+                return typename Trait<T>::Type(*view);
+            }
+        }
+        return std::get<typename Trait<T>::Type>(std::move(value));
+    }
+
+    /**
+     * @brief Returns the contained string as a view.
+     *
+     * Works for strings owned by this value as well as for strings borrowed
+     * from the buffer of a @c Document .
+     *
+     * Throws an exception if the contained value is not a string.
+     *
+     * @return a view of the contained string
+     */
+    inline auto asStringView() const -> std::string_view {
+        if (const auto string = std::get_if<Trait<ValueType::String>::Type>(&value)) {
+            return *string;
+        }
+        return std::get<std::string_view>(value);
+    }
+
+    /**
+     * @brief Returns a pointer to the contained value casted as the given type.
+     *
+     * Does not throw: if the contained value is not of the given type or is
+     * a borrowed string of a @c Document , @c nullptr is returned.
+     *
+     * @tparam T the value type to cast the contained value to
+     * @return the casted value or @c nullptr if the type does not match
+     */
+    template<ValueType T>
+    constexpr inline auto tryAs() const -> const typename Trait<T>::Type* {
+        return type == T ? std::get_if<typename Trait<T>::Type>(&value) : nullptr;
+    }
+
+    /**
+     * @brief Returns the contained string as a view.
+     *
+     * Works for owned strings as well as for strings borrowed from the buffer
+     * of a @c Document . Does not throw.
+     *
+     * @return a view of the contained string or @c std::nullopt if no string is contained
+     */
+    inline auto tryAsStringView() const -> std::optional<std::string_view> {
+        if (const auto string = std::get_if<Trait<ValueType::String>::Type>(&value)) {
+            return *string;
+        }
+        if (const auto view = std::get_if<std::string_view>(&value)) {
+            return *view;
+        }
+        return std::nullopt;
+    }
+
     /**
      * Returns whether the contained type is equal to the given type.
      *
@@ -61,6 +189,31 @@ struct Value {
         return Value::type == type;
     }
 };
+
+/**
+ * @brief Compares the given values.
+ *
+ * Values are equal if they have the same type and equal contents. Borrowed
+ * strings compare equal to owned ones with the same characters.
+ *
+ * @param lhs the one value
+ * @param rhs the other value
+ * @return whether the values are equal
+ */
+inline auto operator==(const Value& lhs, const Value& rhs) -> bool {
+    if (lhs.type != rhs.type) {
+        return false;
+    }
+    switch (lhs.type) {
+        case ValueType::Null:   return true;
+        case ValueType::String: return lhs.tryAsStringView() == rhs.tryAsStringView();
+        default:                return lhs.value == rhs.value;
+    }
+}
+
+inline auto operator!=(const Value& lhs, const Value& rhs) -> bool {
+    return !(lhs == rhs);
+}
 }
 
 #endif /* SimpleJSON_Value_hpp */
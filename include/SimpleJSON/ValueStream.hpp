@@ -0,0 +1,169 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_ValueStream_hpp
+#define SimpleJSON_ValueStream_hpp
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <string_view>
+
+#include "Value.hpp"
+
+namespace simple_json {
+/**
+ * @brief Parses a sequence of concatenated JSON values, such as newline
+ * delimited JSON (NDJSON), one value after the other.
+ *
+ * The values are separated by optional whitespaces. Parsing a value into a
+ * previously parsed @c Value reuses its containers and strings, as well as
+ * the internal buffers of the parser; values of a similar shape are
+ * therefore parsed without allocating.
+ *
+ * If a value is malformed, an @c Exception is thrown and the stream cannot
+ * be continued.
+ */
+class ValueStream {
+    struct State;
+
+    /** The state of the parser.                  */
+    std::unique_ptr<State> state;
+    /** The value most recently parsed by @c next(). */
+    Value current;
+
+public:
+    /**
+     * @brief An iterator over the values of a stream.
+     *
+     * All iterators of a stream refer to the same value, which is replaced
+     * when any of them is advanced.
+     */
+    class Iterator {
+        /** The stream, @c nullptr at the end. */
+        ValueStream* stream;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Value;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Value*;
+        using reference         = const Value&;
+
+        /**
+         * Constructs an iterator over the given stream.
+         *
+         * @param stream the stream, @c nullptr for the end iterator
+         */
+        constexpr inline explicit Iterator(ValueStream* stream): stream(stream) {}
+
+        inline auto operator*() const -> reference { return stream->current; }
+        inline auto operator->() const -> pointer { return &stream->current; }
+
+        inline auto operator++() -> Iterator& {
+            if (!stream->next(stream->current)) {
+                stream = nullptr;
+            }
+            return *this;
+        }
+
+        inline auto operator==(const Iterator& other) const -> bool { return stream == other.stream; }
+        inline auto operator!=(const Iterator& other) const -> bool { return stream != other.stream; }
+    };
+
+    /**
+     * @brief Prepares the parsing of the given buffer.
+     *
+     * The buffer is borrowed and needs to outlive the stream.
+     *
+     * @param data the buffer containing the JSON values
+     * @param offset the position of the buffer in the original input
+     */
+    explicit ValueStream(std::string_view data, long long offset = 0);
+
+    /**
+     * Prepares the parsing of the remaining content of the given input
+     * stream, which is read at once and owned by the stream.
+     *
+     * @param stream the input stream to read the JSON values from
+     */
+    explicit ValueStream(std::istream& stream);
+
+    ValueStream(ValueStream&&) noexcept;
+    auto operator=(ValueStream&&) noexcept -> ValueStream&;
+    ~ValueStream();
+
+    /**
+     * @brief Parses the next value into the given value.
+     *
+     * The containers and strings of the given value are reused if they are
+     * not shared with copies of it.
+     *
+     * @param value the value to be replaced by the parsed value
+     * @return whether a value was parsed, @c false at the end of the data
+     * @throws Exception if the parsing failed
+     */
+    auto next(Value& value) -> bool;
+
+    /**
+     * Returns the amount of bytes consumed so far.
+     *
+     * @return the current position in the data
+     */
+    auto getPosition() const -> std::size_t;
+
+    /**
+     * @brief Parses the first value and returns an iterator to it.
+     *
+     * The stream can only be iterated once.
+     *
+     * @return an iterator to the first value
+     * @throws Exception if the parsing failed
+     */
+    inline auto begin() -> Iterator {
+        return next(current) ? Iterator(this) : end();
+    }
+
+    inline auto end() -> Iterator {
+        return Iterator(nullptr);
+    }
+};
+
+/**
+ * @brief Prepares the parsing of the concatenated JSON values in the given buffer.
+ *
+ * The buffer is borrowed and needs to outlive the returned stream.
+ *
+ * @param data the buffer containing the JSON values
+ * @return the stream of the values
+ */
+static inline auto parseMany(std::string_view data) -> ValueStream {
+    return ValueStream(data);
+}
+
+/**
+ * Prepares the parsing of the concatenated JSON values remaining in the given
+ * input stream.
+ *
+ * @param stream the input stream to read the JSON values from
+ * @return the stream of the values
+ */
+static inline auto parseMany(std::istream& stream) -> ValueStream {
+    return ValueStream(stream);
+}
+}
+
+#endif /* SimpleJSON_ValueStream_hpp */
@@ -32,7 +32,11 @@ enum class ValueType {
     /** An object.                             */
     Object,
     /** The special value `null`.              */
-    Null
+    Null,
+    /** A positive integer too large for Int.  */
+    UInt,
+    /** A floating point number.               */
+    Double
 };
 }
 
@@ -0,0 +1,241 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_Writer_hpp
+#define SimpleJSON_Writer_hpp
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Object.hpp"
+
+namespace simple_json {
+/**
+ * The options of a writer.
+ */
+struct WriterOptions {
+    /** Whether to break lines and indent the nested elements. */
+    bool pretty = false;
+    /** The amount of spaces per indentation level if pretty.  */
+    std::size_t indent = 2;
+};
+
+/**
+ * The function the written data is passed to in pieces.
+ */
+using Sink = std::function<void(std::string_view)>;
+
+/**
+ * @brief Writes JSON data.
+ *
+ * The data is written piece by piece using the member functions, which are
+ * the same as the ones of a handler of a @c Reader : a writer can be used to
+ * write parsed data without creating values. Complete values are written
+ * using @c value() .
+ *
+ * The data is written into a growable buffer. If a sink is given, the buffer
+ * is passed to the sink and emptied whenever it exceeds a size limit, when
+ * @c flush() is called and when the writer is destroyed. Since the
+ * destructor cannot report the exceptions thrown by the sink, they are
+ * ignored; @c flush() is called before to handle them.
+ *
+ * The order of the calls is not validated: they need to form valid JSON.
+ * Floating point numbers are written in their shortest form that reads back
+ * as the same number; infinite numbers and NaN are written as @c null .
+ */
+class Writer {
+    /** The written data not yet passed to the sink.                     */
+    std::string buffer;
+    /** The sink the data is passed to, if any.                          */
+    Sink sink;
+    /** The options of this writer.                                      */
+    WriterOptions options;
+    /** Whether the open containers have no elements yet, innermost last. */
+    std::vector<bool> empty;
+    /** Whether a key was written, followed by its value.                */
+    bool afterKey = false;
+
+    /**
+     * Writes the separator and indentation preceding an element.
+     */
+    void separate();
+
+    /**
+     * Writes a line break and the indentation of the current level.
+     */
+    void newLine();
+
+    /**
+     * Writes the given string surrounded by quotes, escaping its special characters.
+     *
+     * @param string the string to write
+     */
+    void writeString(std::string_view string);
+
+    /**
+     * Passes the buffer to the sink if it exceeds the size limit.
+     */
+    void drain();
+
+public:
+    /**
+     * Constructs a writer writing into its buffer.
+     *
+     * @param options the options
+     */
+    explicit Writer(const WriterOptions& options = {});
+
+    /**
+     * Constructs a writer passing the written data to the given sink.
+     *
+     * @param sink the sink
+     * @param options the options
+     */
+    explicit Writer(Sink sink, const WriterOptions& options = {});
+
+    /**
+     * Constructs a writer writing to the given output stream, which needs to
+     * outlive the writer.
+     *
+     * @param stream the output stream
+     * @param options the options
+     */
+    explicit Writer(std::ostream& stream, const WriterOptions& options = {});
+
+    /**
+     * Constructs a writer taking over the buffered data and the sink of the
+     * given writer.
+     *
+     * @param other the writer to move
+     */
+    Writer(Writer&& other);
+
+    /**
+     * Flushes this writer and takes over the buffered data and the sink of
+     * the given writer.
+     *
+     * @param other the writer to move
+     * @return this writer
+     */
+    auto operator=(Writer&& other) -> Writer&;
+
+    /**
+     * Passes the buffered data to the sink, if any, ignoring its exceptions.
+     */
+    ~Writer();
+
+    void startObject();
+    void key(std::string_view name);
+    void endObject();
+    void startArray();
+    void endArray();
+    void string(std::string_view value);
+    void integer(long value);
+    void unsignedInteger(unsigned long value);
+    void floating(double value);
+    void boolean(bool value);
+    void null();
+
+    /**
+     * Writes the given value, including its nested values.
+     *
+     * @param value the value to write
+     */
+    void value(const Value& value);
+
+    /**
+     * Writes the given object.
+     *
+     * @param content the members of the object
+     */
+    void object(const ObjectContent& content);
+
+    /**
+     * Writes the given array.
+     *
+     * @param content the elements of the array
+     */
+    void array(const ArrayContent& content);
+
+    /**
+     * Passes the buffered data to the sink, if any.
+     */
+    void flush();
+
+    /**
+     * Returns the written data not yet passed to the sink.
+     *
+     * @return the buffered data
+     */
+    inline auto getBuffer() const -> std::string_view {
+        return buffer;
+    }
+
+    /**
+     * Moves the written data not yet passed to the sink out of this writer.
+     *
+     * @return the buffered data
+     */
+    inline auto take() -> std::string {
+        auto toReturn = std::move(buffer);
+        buffer.clear();
+        return toReturn;
+    }
+};
+
+/**
+ * Serializes the given value.
+ *
+ * @param value the value to serialize
+ * @param options the options of the writer
+ * @return the JSON text
+ */
+auto serialize(const Value& value, const WriterOptions& options = {}) -> std::string;
+
+/**
+ * Serializes the given object.
+ *
+ * @param content the members of the object
+ * @param options the options of the writer
+ * @return the JSON text
+ */
+auto serialize(const ObjectContent& content, const WriterOptions& options = {}) -> std::string;
+
+/**
+ * Serializes the given array.
+ *
+ * @param content the elements of the array
+ * @param options the options of the writer
+ * @return the JSON text
+ */
+auto serialize(const ArrayContent& content, const WriterOptions& options = {}) -> std::string;
+
+/**
+ * Serializes the given object.
+ *
+ * @param object the object to serialize
+ * @param options the options of the writer
+ * @return the JSON text
+ */
+static inline auto serialize(const Object& object, const WriterOptions& options = {}) -> std::string {
+    return serialize(object.view().getContent(), options);
+}
+}
+
+#endif /* SimpleJSON_Writer_hpp */
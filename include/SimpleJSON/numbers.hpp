@@ -0,0 +1,72 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_numbers_hpp
+#define SimpleJSON_numbers_hpp
+
+#include "ValueType.hpp"
+
+/**
+ * @file numbers.hpp
+ *
+ * The number kernel of the parser: converts JSON numbers in place.
+ */
+
+namespace simple_json::numbers {
+/**
+ * A converted JSON number.
+ */
+struct Number {
+    /** The type of the number: @c Int , @c UInt or @c Double . */
+    ValueType type;
+
+    union {
+        /** The value if the type is @c Int .    */
+        long integer;
+        /** The value if the type is @c UInt .   */
+        unsigned long unsignedInteger;
+        /** The value if the type is @c Double . */
+        double floating;
+    };
+};
+
+/**
+ * @brief Converts the JSON number at the beginning of the given range.
+ *
+ * Numbers without fraction and exponent are integers if they fit into a
+ * @c long , or, if not negative, into an @c unsigned @c long ; all other
+ * numbers are correctly rounded to the nearest @c double .
+ *
+ * @param begin the first character of the number
+ * @param end the end of the input
+ * @param number set to the converted number
+ * @return the character following the number or @c nullptr if the number is
+ * malformed or too large for a @c double
+ */
+auto parse(const char* begin, const char* end, Number& number) -> const char*;
+
+/**
+ * @brief Returns the end of the JSON number at the beginning of the given range.
+ *
+ * Only the grammar of the number is checked: its magnitude is not limited.
+ *
+ * @param begin the first character of the number
+ * @param end the end of the input
+ * @return the character following the number or @c nullptr if the number is malformed
+ */
+auto skip(const char* begin, const char* end) -> const char*;
+}
+
+#endif /* SimpleJSON_numbers_hpp */
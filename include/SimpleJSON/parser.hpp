@@ -16,13 +16,21 @@
 #ifndef SimpleJSON_parser_hpp
 #define SimpleJSON_parser_hpp
 
+#include <cstddef>
 #include <istream>
+#include <string_view>
 
 #include "Object.hpp"
+#include "Result.hpp"
+#include "Stats.hpp"
 
 namespace simple_json {
 /**
- * Parses a JSON object or array from the given input stream.
+ * @brief Parses a JSON object or array from the given input stream.
+ *
+ * Seekable streams are read at once and positioned behind the value
+ * afterwards, other streams are read up to the end of the value, see
+ * @c parse(std::istream&, Handler&) .
  *
  * Does not check for the integrity of JSON data.
  *
@@ -45,6 +53,118 @@ static inline auto parse(std::istream&& stream) -> Value {
     return parse(stream);
 }
 
+/**
+ * @brief Parses a JSON object or array from the given buffer.
+ *
+ * The buffer is read directly, without the overhead of an input stream.
+ *
+ * Does not check for the integrity of JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @return the JSON data as @c Value
+ * @throws Exception if the parsing failed
+ */
+auto parse(std::string_view data) -> Value;
+
+/**
+ * @brief Parses a JSON object or array from the given buffer.
+ *
+ * The buffer is read directly, without the overhead of an input stream.
+ *
+ * Does not check for the integrity of JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @param size the size of the buffer in bytes
+ * @return the JSON data as @c Value
+ * @throws Exception if the parsing failed
+ */
+static inline auto parse(const char* data, std::size_t size) -> Value {
+    return parse(std::string_view(data, size));
+}
+
+/**
+ * @brief Parses a JSON object or array from the given buffer without throwing.
+ *
+ * Accepts the same data as @c parse(std::string_view) , but returns the
+ * error instead of throwing an exception. The message of the error is only
+ * formatted if requested.
+ *
+ * @param data the buffer containing the JSON data
+ * @return the JSON data as @c Value or the error
+ */
+auto tryParse(std::string_view data) -> Result<Value>;
+
+/**
+ * @brief Parses a JSON object or array from the given buffer without throwing.
+ *
+ * Accepts the same data as @c parse(const char*, std::size_t) , but returns
+ * the error instead of throwing an exception.
+ *
+ * @param data the buffer containing the JSON data
+ * @param size the size of the buffer in bytes
+ * @return the JSON data as @c Value or the error
+ */
+static inline auto tryParse(const char* data, std::size_t size) -> Result<Value> {
+    return tryParse(std::string_view(data, size));
+}
+
+/**
+ * @brief Parses a JSON object or array from the given input stream without
+ * throwing.
+ *
+ * Accepts the same data as @c parse(std::istream&) , but returns the error
+ * instead of throwing an exception. The stream is read like there. If the
+ * parsing failed, the fail state of the stream is set and the stream is
+ * positioned behind the offending character.
+ *
+ * @param stream the input stream to read the JSON data from
+ * @return the JSON data as @c Value or the error
+ */
+auto tryParse(std::istream& stream) -> Result<Value>;
+
+/**
+ * @brief Parses any JSON value from the given buffer, checking the integrity
+ * of the JSON data.
+ *
+ * The data is validated while it is parsed: it needs to be valid UTF-8 and
+ * conform to RFC 8259, see @c Validator . Additionally, like @c parse , numbers
+ * too large for a @c double are rejected, which @c validate accepts.
+ *
+ * @param data the buffer containing the JSON data
+ * @return the JSON data as @c Value
+ * @throws Exception if the data is invalid
+ */
+auto parseStrict(std::string_view data) -> Value;
+
+/**
+ * @brief Parses any JSON value from the given buffer, checking the integrity
+ * of the JSON data, without throwing.
+ *
+ * Accepts the same data as @c parseStrict(std::string_view) , but returns the
+ * error instead of throwing an exception.
+ *
+ * @param data the buffer containing the JSON data
+ * @return the JSON data as @c Value or the first error of the data
+ */
+auto tryParseStrict(std::string_view data) -> Result<Value>;
+
+#ifdef SIMPLE_JSON_STATS
+/**
+ * @brief Parses a JSON object or array from the given buffer and collects
+ * the statistics of the parse.
+ *
+ * The statistics are added to the given ones, so they can be accumulated
+ * over multiple parses. If the parsing fails, the statistics contain the
+ * part parsed so far.
+ *
+ * @param data the buffer containing the JSON data
+ * @param stats the statistics to add to
+ * @return the JSON data as @c Value
+ * @throws Exception if the parsing failed
+ */
+auto parse(std::string_view data, ParseStats& stats) -> Value;
+#endif
+
 /**
  * Parses a JSON object or array from the given input stream.
  *
@@ -74,6 +194,37 @@ template<ValueType T>
 constexpr inline auto parse(std::istream&& stream) {
     return parse(stream).as<T>();
 }
+
+/**
+ * Parses a JSON object or array from the given buffer.
+ *
+ * Does not check for the integrity of the JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @tparam T the @c ValueType to cast the parsed data to
+ * @return the parsed data casted to the given JSON value type
+ * @throws Exception if the parsing failed or the contained data has a different type
+ */
+template<ValueType T>
+constexpr inline auto parse(std::string_view data) {
+    return parse(data).as<T>();
+}
+
+/**
+ * Parses a JSON object or array from the given buffer.
+ *
+ * Does not check for the integrity of the JSON data.
+ *
+ * @param data the buffer containing the JSON data
+ * @param size the size of the buffer in bytes
+ * @tparam T the @c ValueType to cast the parsed data to
+ * @return the parsed data casted to the given JSON value type
+ * @throws Exception if the parsing failed or the contained data has a different type
+ */
+template<ValueType T>
+constexpr inline auto parse(const char* data, std::size_t size) {
+    return parse(data, size).as<T>();
+}
 }
 
 #endif /* SimpleJSON_parser_hpp */
@@ -0,0 +1,173 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_scanner_hpp
+#define SimpleJSON_scanner_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file scanner.hpp
+ *
+ * The vectorized first stage of the parser: classifies the input in blocks of
+ * 64 bytes. Uses AVX2 or SSE2 if available, chosen at runtime, and a portable
+ * scalar implementation otherwise.
+ */
+
+namespace simple_json::scanner {
+/** The amount of bytes classified at once. */
+constexpr std::size_t blockSize = 64;
+
+/**
+ * @brief The classification of a block of 64 bytes.
+ *
+ * Bit @c n of each mask corresponds to byte @c n of the block.
+ */
+struct Block {
+    /** The positions of quotes.                          */
+    std::uint64_t quotes;
+    /** The positions of backslashes.                     */
+    std::uint64_t backslashes;
+    /** The positions of the characters <tt>{}[]:,</tt> . */
+    std::uint64_t structurals;
+    /** The positions of JSON whitespaces.                */
+    std::uint64_t whitespaces;
+};
+
+/**
+ * Returns whether the given character is a JSON whitespace.
+ *
+ * @param c the character to check
+ * @return whether the character is a space, a tab, a line feed or a carriage return
+ */
+constexpr inline auto isWhitespace(char c) -> bool {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+ * Classifies the given block of 64 bytes.
+ *
+ * @param block the block to classify, must be at least 64 bytes long
+ * @return the classification of the block
+ */
+auto classify(const char* block) -> Block;
+
+/**
+ * Returns the position of the first character in the given range that is not
+ * a JSON whitespace, using the vectorized implementation.
+ *
+ * @param begin the beginning of the range
+ * @param end the end of the range
+ * @return the first non-whitespace character or @c end
+ */
+auto skipWhitespaceRun(const char* begin, const char* end) -> const char*;
+
+/**
+ * @brief Returns the position of the first character in the given range that
+ * is not a JSON whitespace.
+ *
+ * Short runs are handled inline, longer ones are handed over to the vectorized
+ * implementation.
+ *
+ * @param begin the beginning of the range
+ * @param end the end of the range
+ * @return the first non-whitespace character or @c end
+ */
+inline auto skipWhitespaces(const char* begin, const char* end) -> const char* {
+    for (int i = 0; i < 4; ++i, ++begin) {
+        if (begin == end || !isWhitespace(*begin)) {
+            return begin;
+        }
+    }
+    return skipWhitespaceRun(begin, end);
+}
+
+/**
+ * Returns the position of the first quote or backslash in the given range.
+ *
+ * @param begin the beginning of the range
+ * @param end the end of the range
+ * @return the first quote or backslash or @c end
+ */
+auto findQuoteOrBackslash(const char* begin, const char* end) -> const char*;
+
+/**
+ * Returns the position of the first character in the given range that needs
+ * to be escaped in a JSON string: a quote, a backslash or a control character.
+ *
+ * @param begin the beginning of the range
+ * @param end the end of the range
+ * @return the first character to be escaped or @c end
+ */
+auto findEscapable(const char* begin, const char* end) -> const char*;
+
+/**
+ * @brief Returns the position of the first invalid UTF-8 sequence in the given range.
+ *
+ * Overlong encodings, encoded surrogates, code points above U+10FFFF and
+ * truncated sequences are invalid.
+ *
+ * @param begin the beginning of the range
+ * @param end the end of the range
+ * @return the first byte of the first invalid sequence or @c end
+ */
+auto validateUtf8(const char* begin, const char* end) -> const char*;
+
+/**
+ * The state carried between the pieces of an incrementally indexed input.
+ */
+struct IndexState {
+    /** Whether the next character is escaped, in the lowest bit. */
+    std::uint64_t escaped = 0;
+    /** All bits set if the next character is inside a string.    */
+    std::uint64_t inString = 0;
+};
+
+/**
+ * @brief Collects the positions of all structural characters outside of strings.
+ *
+ * Escaped quotes are taken into account.
+ *
+ * @param data the JSON data to index
+ * @param positions the vector the positions are appended to
+ * @return whether all strings in the data are terminated
+ */
+auto indexStructurals(std::string_view data, std::vector<std::size_t>& positions) -> bool;
+
+/**
+ * @brief Collects the positions of all structural characters outside of strings
+ * in a piece of an input.
+ *
+ * The input can be indexed in consecutive pieces by passing the same state;
+ * all pieces but the last one need to be a multiple of @c blockSize long.
+ *
+ * @param data the piece of the JSON data to index
+ * @param positions the vector the positions, relative to the piece, are appended to
+ * @param state the state left by the preceding piece, updated for the following one
+ */
+void indexStructurals(std::string_view data, std::vector<std::size_t>& positions, IndexState& state);
+
+/**
+ * Returns the name of the implementation chosen for the running processor.
+ *
+ * @return either @c "avx2", @c "sse2" or @c "fallback"
+ */
+auto implementationName() -> const char*;
+}
+
+#endif /* SimpleJSON_scanner_hpp */
@@ -0,0 +1,56 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_strings_hpp
+#define SimpleJSON_strings_hpp
+
+/**
+ * @file strings.hpp
+ *
+ * The string kernel of the parser: finds the end of JSON strings and decodes
+ * their escape sequences.
+ */
+
+namespace simple_json::strings {
+/**
+ * @brief Finds the closing quote of a JSON string.
+ *
+ * Escaped quotes are skipped.
+ *
+ * @param begin the first character after the opening quote
+ * @param end the end of the input
+ * @param escaped set to whether the string contains escape sequences
+ * @return the position of the closing quote or @c end if not terminated
+ */
+auto findEnd(const char* begin, const char* end, bool& escaped) -> const char*;
+
+/**
+ * @brief Decodes the escape sequences of the given raw string content.
+ *
+ * The output buffer needs to be as large as the raw content: the decoded
+ * string is never longer than its encoded form. Escaped UTF-16 code units are
+ * encoded as UTF-8, unpaired surrogates are replaced by U+FFFD.
+ *
+ * @param begin the beginning of the raw string content, set to the invalid
+ * escape sequence if the decoding fails
+ * @param end the end of the raw string content
+ * @param out the output buffer
+ * @return the end of the decoded string or @c nullptr if an invalid escape
+ * sequence was found
+ */
+auto unescape(const char*& begin, const char* end, char* out) -> char*;
+}
+
+#endif /* SimpleJSON_strings_hpp */
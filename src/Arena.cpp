@@ -0,0 +1,63 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+
+#include <SimpleJSON/Arena.hpp>
+#include <SimpleJSON/Stats.hpp>
+
+namespace simple_json {
+/** The maximum size of the chunks allocated by an arena. */
+constexpr std::size_t maximumChunkSize = 16 * 1024 * 1024;
+
+auto Arena::grow(std::size_t size, std::size_t alignment) -> void* {
+    const auto needed = sizeof(Chunk) + size + alignment;
+    if (current != nullptr && needed > nextSize / 2) {
+        // Large allocations get a chunk of their own, keeping the current one.
+        auto chunk = static_cast<Chunk*>(allocateOnHeap(needed));
+        chunk->previous  = chunks->previous;
+        chunks->previous = chunk;
+        const auto address = (reinterpret_cast<std::uintptr_t>(chunk + 1) + alignment - 1) & ~(alignment - 1);
+        return reinterpret_cast<void*>(address);
+    }
+
+    const auto chunkSize = std::max(nextSize, needed);
+    auto chunk = static_cast<Chunk*>(allocateOnHeap(chunkSize));
+    chunk->previous = chunks;
+    chunks   = chunk;
+    current  = reinterpret_cast<char*>(chunk + 1);
+    end      = reinterpret_cast<char*>(chunk) + chunkSize;
+    nextSize = std::min(nextSize * 2, maximumChunkSize);
+
+    return allocate(size, alignment);
+}
+
+auto allocateOnHeap(std::size_t size) -> void* {
+#ifdef SIMPLE_JSON_STATS
+    stats::countAllocation(size);
+#endif
+    return ::operator new(size);
+}
+
+void Arena::release() {
+    while (chunks != nullptr) {
+        const auto previous = chunks->previous;
+        ::operator delete(chunks);
+        chunks = previous;
+    }
+    current = nullptr;
+    end     = nullptr;
+}
+}
@@ -0,0 +1,206 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/Compact.hpp>
+#include <SimpleJSON/Reader.hpp>
+
+namespace simple_json {
+void CompactValue::release() {
+    if (!is(ValueType::String)) {
+        const auto elements = values();
+        for (std::size_t i = 0; i < count(); ++i) {
+            elements[i].~CompactValue();
+        }
+    }
+    ::operator delete(payload.block);
+}
+
+void CompactValue::clone() {
+    if (payload.block == nullptr) {
+        return;
+    }
+    if (is(ValueType::String)) {
+        const auto size = sizeof(Block) + payload.block->size;
+        const auto copy = static_cast<Block*>(::operator new(size));
+        std::memcpy(copy, payload.block, size);
+        payload.block = copy;
+        return;
+    }
+    const auto elements = values();
+    const auto copy     = static_cast<Block*>(::operator new(sizeof(Block) + count() * sizeof(CompactValue)));
+    copy->size = count();
+    const auto copies = reinterpret_cast<CompactValue*>(copy + 1);
+    std::size_t i = 0;
+    try {
+        for (; i < count(); ++i) {
+            new (copies + i) CompactValue(elements[i]);
+        }
+    } catch (...) {
+        while (i > 0) {
+            copies[--i].~CompactValue();
+        }
+        ::operator delete(copy);
+        throw;
+    }
+    payload.block = copy;
+}
+
+auto CompactValue::makeString(std::string_view string) -> CompactValue {
+    auto toReturn = CompactValue();
+    if (string.size() <= sizeof(payload) + sizeof(characters)) {
+        std::memcpy(reinterpret_cast<char*>(&toReturn), string.data(), string.size());
+        toReturn.tag = static_cast<std::uint8_t>(static_cast<std::uint8_t>(ValueType::String) | inlineBit
+                                                 | string.size() << lengthShift);
+        return toReturn;
+    }
+    const auto block = static_cast<Block*>(::operator new(sizeof(Block) + string.size()));
+    block->size = string.size();
+    std::memcpy(block + 1, string.data(), string.size());
+    toReturn.payload.block = block;
+    toReturn.tag           = static_cast<std::uint8_t>(ValueType::String);
+    return toReturn;
+}
+
+auto CompactValue::makeContainer(ValueType type, CompactValue* values, std::size_t count) -> CompactValue {
+    auto toReturn = CompactValue();
+    if (count > 0) {
+        const auto block = static_cast<Block*>(::operator new(sizeof(Block) + count * sizeof(CompactValue)));
+        block->size = count;
+        const auto elements = reinterpret_cast<CompactValue*>(block + 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            new (elements + i) CompactValue(std::move(values[i]));
+        }
+        toReturn.payload.block = block;
+    } else {
+        toReturn.payload.block = nullptr;
+    }
+    toReturn.tag = static_cast<std::uint8_t>(type);
+    return toReturn;
+}
+
+/**
+ * @brief Builds a compact value from the elements reported by a @c Reader .
+ *
+ * The elements of the open arrays and objects, and the keys of the objects,
+ * are collected on a stack; a closed container is allocated once with its
+ * final size.
+ */
+class CompactBuilder {
+    /** The values of the open containers, keys alternating with values in objects. */
+    std::vector<CompactValue> values;
+    /** The positions of the first values of the open containers.                  */
+    std::vector<std::size_t> starts;
+
+    /**
+     * Creates a value of the given type with the given payload.
+     *
+     * @param type the type of the value
+     * @param payload the payload of the value
+     */
+    inline void add(ValueType type, CompactValue::Payload payload) {
+        auto& value = values.emplace_back();
+        value.payload = payload;
+        value.tag     = static_cast<std::uint8_t>(type);
+    }
+
+    /**
+     * Opens an array or object.
+     */
+    inline void open() {
+        starts.push_back(values.size());
+    }
+
+    /**
+     * Closes the innermost open container, replacing its values by it.
+     *
+     * @param type the type of the container
+     */
+    inline void close(ValueType type) {
+        const auto start = starts.back();
+        starts.pop_back();
+        auto container = CompactValue::makeContainer(type, values.data() + start, values.size() - start);
+        values.resize(start);
+        values.push_back(std::move(container));
+    }
+
+public:
+    inline void startObject() { open();                     }
+    inline void endObject()   { close(ValueType::Object);   }
+    inline void startArray()  { open();                     }
+    inline void endArray()    { close(ValueType::Array);    }
+
+    inline void key(std::string_view name) {
+        values.push_back(CompactValue::makeString(name));
+    }
+
+    inline void string(std::string_view value) {
+        values.push_back(CompactValue::makeString(value));
+    }
+
+    inline void integer(long value) {
+        CompactValue::Payload payload;
+        payload.integer = value;
+        add(ValueType::Int, payload);
+    }
+
+    inline void unsignedInteger(unsigned long value) {
+        CompactValue::Payload payload;
+        payload.unsignedInteger = value;
+        add(ValueType::UInt, payload);
+    }
+
+    inline void floating(double value) {
+        CompactValue::Payload payload;
+        payload.floating = value;
+        add(ValueType::Double, payload);
+    }
+
+    inline void boolean(bool value) {
+        CompactValue::Payload payload {};
+        payload.boolean = value;
+        add(ValueType::Bool, payload);
+    }
+
+    inline void null() {
+        values.emplace_back();
+    }
+
+    /**
+     * Returns the built value.
+     *
+     * @return the root value
+     */
+    inline auto getRoot() && -> CompactValue {
+        return std::move(values.back());
+    }
+};
+
+auto parseCompact(std::string_view data) -> CompactValue {
+    auto builder = CompactBuilder();
+    parse(data, builder);
+    return std::move(builder).getRoot();
+}
+
+auto parseCompact(std::istream& stream) -> CompactValue {
+    auto builder = CompactBuilder();
+    parse(stream, builder);
+    return std::move(builder).getRoot();
+}
+}
@@ -0,0 +1,147 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <SimpleJSON/Cursor.hpp>
+#include <SimpleJSON/Lazy.hpp>
+
+namespace simple_json {
+/**
+ * Creates a cursor reading the given data from the given position.
+ *
+ * @param data the complete JSON data
+ * @param position the position to start reading at
+ * @return the cursor
+ */
+static inline auto cursorAt(std::string_view data, const char* position) -> Cursor {
+    auto toReturn = Cursor(data);
+    toReturn.seek(position);
+    return toReturn;
+}
+
+/**
+ * Advances the given cursor behind the separator following an element.
+ *
+ * @param in the cursor, positioned behind the element
+ * @param closing the character closing the container
+ * @return whether another element follows
+ * @throws Exception if neither a separator nor the closing character follows
+ */
+static inline auto nextElement(Cursor& in, char closing) -> bool {
+    skipWhitespaces(in);
+    if (in.peek() == ',') {
+        in.get();
+        skipWhitespaces(in);
+        return in.peek() != closing;
+    }
+    if (in.peek() != closing) {
+        throw Exception(closing, static_cast<char>(in.peek()), in.tellg());
+    }
+    return false;
+}
+
+/**
+ * Searches the member with the given key, starting at the current position
+ * of the given cursor.
+ *
+ * @param in the cursor, positioned at a member or the closing bracket
+ * @param name the key to search
+ * @return the first character of the value or @c nullptr if not found
+ * @throws Exception if the object is malformed
+ */
+static inline auto findMember(Cursor& in, std::string_view name) -> const char* {
+    while (in.peek() != '}') {
+        bool escaped;
+        const auto raw = readRawString(in, escaped);
+        const auto found = escaped ? decode(in, raw, escaped) == name : raw == name;
+        expectConsume(in, ':');
+        skipWhitespaces(in);
+        const auto value = in.position();
+        if (in.peek() == EOF) {
+            throw Exception('}', static_cast<char>(EOF), in.tellg());
+        }
+        skipValue(in);
+        nextElement(in, '}');
+        if (found) {
+            return value;
+        }
+    }
+    return nullptr;
+}
+
+auto LazyValue::readNumber() const -> numbers::Number {
+    auto in = cursorAt(data, start);
+    return simple_json::readNumber(in);
+}
+
+auto LazyValue::readString() const -> std::string {
+    auto in = cursorAt(data, start);
+    bool escaped;
+    const auto raw = readRawString(in, escaped);
+    return decode(in, raw, escaped);
+}
+
+auto LazyValue::skip() const -> const char* {
+    auto in = cursorAt(data, start);
+    skipValue(in);
+    return in.position();
+}
+
+auto LazyValue::materialize() const -> Value {
+    auto in = cursorAt(data, start);
+    return readValue(in);
+}
+
+auto LazyArray::begin() const -> Iterator {
+    auto in = cursorAt(data, start + 1);
+    skipWhitespaces(in);
+    if (in.peek() == EOF) {
+        throw Exception(']', static_cast<char>(EOF), in.tellg());
+    }
+    if (in.peek() == ']') {
+        return end();
+    }
+    return LazyValue(data, in.position());
+}
+
+auto LazyArray::Iterator::operator++() -> Iterator& {
+    auto in = cursorAt(current.data, current.start);
+    skipValue(in);
+    current.start = nextElement(in, ']') ? in.position() : nullptr;
+    return *this;
+}
+
+auto LazyObject::find(std::string_view name) const -> std::optional<LazyValue> {
+    auto in = cursorAt(data, start + 1);
+    skipWhitespaces(in);
+    // The search continues after a match, so the last of duplicated keys wins.
+    const char* value = nullptr;
+    while (const auto found = findMember(in, name)) {
+        value = found;
+    }
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    return LazyValue(data, value);
+}
+
+auto parseLazy(std::string_view data) -> LazyValue {
+    auto in = Cursor(data);
+    skipWhitespaces(in);
+    if (in.peek() != '{' && in.peek() != '[') {
+        throw Exception('{', static_cast<char>(in.peek()), in.tellg());
+    }
+    return LazyValue(data, in.position());
+}
+}
@@ -0,0 +1,106 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <SimpleJSON/MappedFile.hpp>
+
+#if __has_include(<sys/mman.h>) && !defined(SIMPLE_JSON_NO_MMAP)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define SIMPLE_JSON_MMAP 1
+#else
+# include <fstream>
+# include <iterator>
+#endif
+
+namespace simple_json {
+/**
+ * Throws a system error for the last failed system call.
+ *
+ * @param path the path of the file
+ */
+[[noreturn]] static inline void fail(const std::string& path) {
+    throw std::system_error(errno, std::generic_category(), "simple_json::MappedFile: " + path);
+}
+
+#ifdef SIMPLE_JSON_MMAP
+MappedFile::MappedFile(const std::string& path) {
+    const auto descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        fail(path);
+    }
+    struct stat status;
+    auto success = fstat(descriptor, &status) == 0;
+    const auto size = success ? static_cast<std::size_t>(status.st_size) : 0;
+
+    // Empty files cannot be mapped, their content is the empty view.
+    if (success && size > 0) {
+        mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        success = mapping != MAP_FAILED;
+        if (!success) {
+            mapping = nullptr;
+        }
+    }
+    const auto error = errno;
+    close(descriptor);
+    if (!success) {
+        errno = error;
+        fail(path);
+    }
+    if (size > 0) {
+        mappingSize = size;
+        madvise(mapping, size, MADV_SEQUENTIAL);
+        data = std::string_view(static_cast<const char*>(mapping), size);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+}
+#else
+MappedFile::MappedFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        fail(path);
+    }
+    // Unlike the one of a string, the content of a vector keeps its address when moved.
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = std::string_view(buffer.data(), buffer.size());
+}
+
+MappedFile::~MappedFile() = default;
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept:
+    mapping(std::exchange(other.mapping, nullptr)),
+    mappingSize(std::exchange(other.mappingSize, 0)),
+    buffer(std::move(other.buffer)),
+    data(std::exchange(other.data, std::string_view())) {}
+
+auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+    std::swap(mapping, other.mapping);
+    std::swap(mappingSize, other.mappingSize);
+    std::swap(buffer, other.buffer);
+    std::swap(data, other.data);
+    return *this;
+}
+}
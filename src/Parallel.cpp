@@ -0,0 +1,409 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <SimpleJSON/Cursor.hpp>
+#include <SimpleJSON/Lazy.hpp>
+#include <SimpleJSON/Parallel.hpp>
+#include <SimpleJSON/Reader.hpp>
+#include <SimpleJSON/scanner.hpp>
+#include <SimpleJSON/ValueStream.hpp>
+
+#include "TreeBuilder.hpp"
+
+namespace simple_json {
+/**
+ * @brief Tracks the tasks of a parallel parse.
+ *
+ * Waits for the started tasks when destroyed.
+ */
+class Batch {
+    /** The mutex protecting the state.              */
+    std::mutex mutex;
+    /** The condition signalled when a task finishes. */
+    std::condition_variable condition;
+    /** The amount of started, unfinished tasks.      */
+    std::size_t running = 0;
+    /** The first exception thrown by a task.         */
+    std::exception_ptr error;
+    /** Whether a task has failed.                    */
+    std::atomic<bool> failed { false };
+
+public:
+    Batch() = default;
+    Batch(const Batch&) = delete;
+    auto operator=(const Batch&) -> Batch& = delete;
+
+    inline ~Batch() {
+        waitUntil([this] { return running == 0; });
+    }
+
+    /**
+     * Registers a task to be started.
+     */
+    inline void start() {
+        std::lock_guard lock(mutex);
+        ++running;
+    }
+
+    /**
+     * @brief Runs the given function as a registered task.
+     *
+     * The function is skipped if another task has failed.
+     *
+     * @param function the function to run
+     * @param done the flag to be set once the task is finished, if any
+     */
+    template<typename Function>
+    inline void run(Function&& function, bool* done = nullptr) {
+        std::exception_ptr exception;
+        if (!failed.load(std::memory_order_relaxed)) {
+            try {
+                function();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+        {
+            std::lock_guard lock(mutex);
+            if (exception != nullptr) {
+                failed = true;
+                if (error == nullptr) {
+                    error = std::move(exception);
+                }
+            }
+            if (done != nullptr) {
+                *done = true;
+            }
+            --running;
+            // Notified with the lock held: the waiting thread may destroy the batch once it returns.
+            condition.notify_all();
+        }
+    }
+
+    /**
+     * Returns whether a task has failed.
+     *
+     * @return whether an exception was thrown
+     */
+    inline auto hasFailed() const -> bool {
+        return failed.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Skips the tasks not yet run, as if a task had failed.
+     */
+    inline void cancel() {
+        failed = true;
+    }
+
+    /**
+     * Waits until the given predicate, evaluated with the state locked, is met.
+     *
+     * @param predicate the predicate to wait for
+     */
+    template<typename Predicate>
+    inline void waitUntil(Predicate&& predicate) {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, std::forward<Predicate>(predicate));
+    }
+
+    /**
+     * Waits for the started tasks and rethrows the first exception of a task, if any.
+     */
+    inline void finish() {
+        waitUntil([this] { return running == 0; });
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+/**
+ * The values parsed from a chunk, waiting to be consumed in order.
+ */
+struct Chunk {
+    /** The parsed values, followed by values to be reused. */
+    std::vector<Value> values;
+    /** The amount of parsed values.                        */
+    std::size_t count = 0;
+    /** Whether the parsing of the chunk is finished.       */
+    bool done = false;
+};
+
+/**
+ * Returns the end of the chunk starting at the given position.
+ *
+ * @param data the complete data
+ * @param from the start of the chunk
+ * @param size the approximate size of the chunk
+ * @return the position behind the line break following the given size
+ */
+static inline auto chunkEnd(std::string_view data, std::size_t from, std::size_t size) -> std::size_t {
+    if (data.size() - from <= size) {
+        return data.size();
+    }
+    const auto lineBreak = data.find('\n', from + size);
+    return lineBreak == std::string_view::npos ? data.size() : lineBreak + 1;
+}
+
+/**
+ * Parses the chunks on the given pool and consumes the values as they are parsed.
+ *
+ * @param data the complete data
+ * @param consumer the consumer of the values
+ * @param pool the pool to parse on
+ * @param chunkSize the approximate size of the chunks
+ */
+static void parseUnordered(std::string_view data, const ValueConsumer& consumer, ThreadPool& pool, std::size_t chunkSize) {
+    Batch batch;
+    for (std::size_t from = 0; from < data.size() && !batch.hasFailed();) {
+        const auto to = chunkEnd(data, from, chunkSize);
+        batch.start();
+        pool.submit([&batch, &consumer, chunk = data.substr(from, to - from), from] {
+            batch.run([&] {
+                auto stream = ValueStream(chunk, static_cast<long long>(from));
+                Value value;
+                while (stream.next(value)) {
+                    consumer(value);
+                }
+            });
+        });
+        from = to;
+    }
+    batch.finish();
+}
+
+/**
+ * Parses the chunks on the given pool and consumes the values in the order
+ * of the data on the calling thread.
+ *
+ * @param data the complete data
+ * @param consumer the consumer of the values
+ * @param pool the pool to parse on
+ * @param chunkSize the approximate size of the chunks
+ */
+static void parseOrdered(std::string_view data, const ValueConsumer& consumer, ThreadPool& pool, std::size_t chunkSize) {
+    const auto window = 4 * pool.size();
+
+    std::deque<Chunk> chunks;
+    // The values of consumed chunks, parsed into again by the following chunks.
+    std::vector<std::vector<Value>> spare;
+    Batch batch;
+    std::size_t from = 0;
+    while (!batch.hasFailed()) {
+        while (chunks.size() < window && from < data.size()) {
+            const auto to = chunkEnd(data, from, chunkSize);
+            auto& chunk = chunks.emplace_back();
+            if (!spare.empty()) {
+                chunk.values = std::move(spare.back());
+                spare.pop_back();
+            }
+            batch.start();
+            pool.submit([&batch, &chunk, text = data.substr(from, to - from), from] {
+                batch.run([&] {
+                    auto stream = ValueStream(text, static_cast<long long>(from));
+                    auto& values = chunk.values;
+                    for (;; ++chunk.count) {
+                        if (chunk.count == values.size()) {
+                            values.emplace_back();
+                        }
+                        if (!stream.next(values[chunk.count])) {
+                            break;
+                        }
+                    }
+                }, &chunk.done);
+            });
+            from = to;
+        }
+        if (chunks.empty()) {
+            break;
+        }
+        auto& next = chunks.front();
+        batch.waitUntil([&next] { return next.done; });
+        try {
+            for (std::size_t i = 0; i < next.count; ++i) {
+                consumer(next.values[i]);
+            }
+        } catch (...) {
+            // The chunks parsed ahead are not consumed anymore.
+            batch.cancel();
+            throw;
+        }
+        spare.push_back(std::move(next.values));
+        chunks.pop_front();
+    }
+    batch.finish();
+}
+
+void parseParallel(std::string_view data, const ValueConsumer& consumer, ThreadPool& pool, const ParallelOptions& options) {
+    const auto chunkSize = options.chunkSize == 0 ? 1 : options.chunkSize;
+    if (options.ordered) {
+        parseOrdered(data, consumer, pool, chunkSize);
+    } else {
+        parseUnordered(data, consumer, pool, chunkSize);
+    }
+}
+
+void parseParallel(std::istream& stream, const ValueConsumer& consumer, const ParallelOptions& options) {
+    const auto buffer = readAll(stream);
+    parseParallel(std::string_view(buffer), consumer, options);
+}
+
+/**
+ * Finds the array at the given path.
+ *
+ * @param data the complete data
+ * @param path the keys leading to the array
+ * @return the position of the opening bracket of the array
+ */
+static auto locateArray(std::string_view data, const std::vector<std::string_view>& path) -> std::size_t {
+    if (path.empty()) {
+        auto in = Cursor(data);
+        expect(in, '[');
+        return in.consumed();
+    }
+    auto value = parseLazy(data);
+    for (const auto& key : path) {
+        const auto member = value.as<ValueType::Object>().find(key);
+        if (!member) {
+            throw std::out_of_range("simple_json::parseArrayParallel");
+        }
+        value = *member;
+    }
+    if (!value.is(ValueType::Array)) {
+        throw std::bad_variant_access();
+    }
+    return value.getPosition();
+}
+
+/**
+ * @brief Indexes the array starting at the given position and collects the
+ * bounds of its elements.
+ *
+ * The bounds are the opening bracket, the separating commas and the closing
+ * bracket of the array. The data is indexed in pieces to keep the index small.
+ *
+ * @param data the complete data
+ * @param open the position of the opening bracket
+ * @param bounds the vector the bounds are appended to
+ * @throws Exception if the array is not closed
+ */
+static void splitArray(std::string_view data, std::size_t open, std::vector<std::size_t>& bounds) {
+    constexpr auto pieceSize = scanner::blockSize << 14;
+
+    auto state = scanner::IndexState {};
+    std::vector<std::size_t> positions;
+    std::size_t depth = 0;
+    bounds.push_back(open);
+    for (auto offset = open; offset < data.size(); offset += pieceSize) {
+        positions.clear();
+        scanner::indexStructurals(data.substr(offset, pieceSize), positions, state);
+        for (const auto relative : positions) {
+            const auto position = offset + relative;
+            switch (data[position]) {
+                case '[': case '{': ++depth; break;
+
+                case ']': case '}':
+                    if (--depth > 0) {
+                        break;
+                    }
+                    if (data[position] != ']') {
+                        throw Exception(']', data[position], static_cast<long long>(position));
+                    }
+                    bounds.push_back(position);
+                    return;
+
+                case ',':
+                    if (depth == 1) {
+                        bounds.push_back(position);
+                    }
+                    break;
+
+                default: break;
+            }
+        }
+    }
+    throw Exception(']', static_cast<char>(EOF), static_cast<long long>(data.size()));
+}
+
+/**
+ * Returns whether the given data consists of whitespaces only.
+ *
+ * @param data the data to check
+ * @return whether the data is blank
+ */
+static inline auto isBlank(std::string_view data) -> bool {
+    auto in = Cursor(data);
+    skipWhitespaces(in);
+    return in.peek() == EOF;
+}
+
+auto parseArrayParallel(std::string_view data, const std::vector<std::string_view>& path, ThreadPool& pool,
+                        const ParallelOptions& options) -> ArrayContent {
+    std::vector<std::size_t> bounds;
+    splitArray(data, locateArray(data, path), bounds);
+
+    // Element i lies between the bounds i and i + 1. A trailing comma, as well
+    // as an empty array, leaves a blank last element.
+    auto count = bounds.size() - 1;
+    if (isBlank(data.substr(bounds[count - 1] + 1, bounds[count] - bounds[count - 1] - 1))) {
+        --count;
+    }
+
+    // Filled before being wrapped: references into an array would stop it from being shared.
+    std::vector<Value, ArrayContent::allocator_type> elements(count);
+    Batch batch;
+    for (std::size_t first = 0; first < count && !batch.hasFailed();) {
+        auto last = first + 1;
+        while (last < count && bounds[last] - bounds[first] < options.chunkSize) {
+            ++last;
+        }
+        const auto begin = bounds[first] + 1;
+        batch.start();
+        pool.submit([&batch, text = data.substr(begin, bounds[last] - begin), begin, target = &elements[first], count = last - first] {
+            batch.run([&] {
+                auto in      = Cursor(text, static_cast<long long>(begin));
+                auto storage = HeapStorage();
+                auto builder = TreeBuilder(storage);
+                auto reader  = Reader(in, builder);
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (i > 0) {
+                        expectConsume(in, ',');
+                    }
+                    reader.parseValue();
+                    target[i] = std::move(builder).getRoot();
+                }
+                skipWhitespaces(in);
+                if (in.peek() != EOF) {
+                    throw Exception(',', static_cast<char>(in.peek()), in.tellg());
+                }
+            });
+        });
+        first = last;
+    }
+    batch.finish();
+    return ArrayContent(std::move(elements));
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <utility>
+
+#include <SimpleJSON/PushParser.hpp>
+#include <SimpleJSON/PushReader.hpp>
+
+#include "TreeBuilder.hpp"
+
+namespace simple_json {
+/**
+ * The state of a push parser, which is kept at a stable address.
+ */
+struct PushParser::State {
+    /** The storage creating the values.      */
+    HeapStorage storage;
+    /** The handler building the value.       */
+    TreeBuilder<HeapStorage> builder;
+    /** The reader reporting to the builder.  */
+    PushReader<TreeBuilder<HeapStorage>> reader;
+
+    inline State(): builder(storage), reader(builder) {}
+};
+
+PushParser::PushParser(): state(std::make_unique<State>()) {}
+
+PushParser::PushParser(PushParser&&) noexcept = default;
+auto PushParser::operator=(PushParser&&) noexcept -> PushParser& = default;
+PushParser::~PushParser() = default;
+
+auto PushParser::feed(const char* data, std::size_t size) -> std::size_t {
+    return state->reader.feed(data, size);
+}
+
+auto PushParser::isDone() const -> bool {
+    return state->reader.isDone();
+}
+
+auto PushParser::finish() -> Value {
+    state->reader.finish();
+    return std::move(state->builder).getRoot();
+}
+}
@@ -0,0 +1,325 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include <SimpleJSON/Query.hpp>
+
+namespace simple_json {
+/**
+ * Throws the exception for a malformed path.
+ *
+ * @param path the path
+ * @param position the position of the error in the path
+ */
+[[noreturn]] static inline void fail(std::string_view path, std::size_t position) {
+    throw Exception(ErrorCode::UnexpectedCharacter, "Malformed path \"" + std::string(path) + '"', static_cast<long long>(position));
+}
+
+/**
+ * Converts the given array index.
+ *
+ * @param token the token
+ * @param index set to the converted index
+ * @return whether the token is an array index: digits without leading zeros
+ */
+static inline auto toIndex(std::string_view token, std::size_t& index) -> bool {
+    if (token.empty() || (token.size() > 1 && token.front() == '0') || token.size() > 18) {
+        return false;
+    }
+    index = 0;
+    for (const auto character : token) {
+        if (character < '0' || character > '9') {
+            return false;
+        }
+        index = index * 10 + static_cast<std::size_t>(character - '0');
+    }
+    return true;
+}
+
+auto Query::memberNode(std::size_t node, std::string key) -> std::size_t {
+    for (const auto& [name, successor] : nodes[node].members) {
+        if (name == key) {
+            return successor;
+        }
+    }
+    nodes.emplace_back();
+    nodes[node].members.emplace_back(std::move(key), nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+auto Query::elementNode(std::size_t node, std::size_t index) -> std::size_t {
+    for (const auto& [position, successor] : nodes[node].elements) {
+        if (position == index) {
+            return successor;
+        }
+    }
+    nodes.emplace_back();
+    nodes[node].elements.emplace_back(index, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+auto Query::anyNode(std::size_t node) -> std::size_t {
+    if (nodes[node].any == none) {
+        nodes.emplace_back();
+        nodes[node].any = nodes.size() - 1;
+    }
+    return nodes[node].any;
+}
+
+auto Query::compilePointer(std::string_view pointer) -> std::vector<std::size_t> {
+    const auto original = pointer;
+    std::vector<std::size_t> current = { 0 };
+    std::vector<std::size_t> next;
+    while (!pointer.empty()) {
+        // Skips the leading slash
+        pointer.remove_prefix(1);
+        const auto length = std::min(pointer.find('/'), pointer.size());
+
+        std::string key;
+        for (std::size_t i = 0; i < length; ++i) {
+            if (pointer[i] != '~') {
+                key.push_back(pointer[i]);
+            } else if (i + 1 < length && (pointer[i + 1] == '0' || pointer[i + 1] == '1')) {
+                key.push_back(pointer[++i] == '0' ? '~' : '/');
+            } else {
+                fail(original, original.size() - pointer.size() + i);
+            }
+        }
+        std::size_t index;
+        const auto isIndex = toIndex(key, index);
+        next.clear();
+        for (const auto node : current) {
+            next.push_back(memberNode(node, key));
+            if (isIndex) {
+                next.push_back(elementNode(node, index));
+            }
+        }
+        std::swap(current, next);
+        pointer.remove_prefix(length);
+    }
+    return current;
+}
+
+auto Query::compilePath(std::string_view path) -> std::size_t {
+    const auto original = path;
+    std::size_t node = 0;
+    while (!path.empty()) {
+        const auto position = original.size() - path.size();
+        if (path.front() == '[') {
+            const auto end = path.find(']');
+            if (end == std::string_view::npos) {
+                fail(original, original.size());
+            }
+            const auto token = path.substr(1, end - 1);
+            std::size_t index;
+            if (token == "*") {
+                node = anyNode(node);
+            } else if (toIndex(token, index)) {
+                node = elementNode(node, index);
+            } else {
+                fail(original, position + 1);
+            }
+            path.remove_prefix(end + 1);
+            if (!path.empty() && path.front() != '.' && path.front() != '[') {
+                fail(original, original.size() - path.size());
+            }
+        } else {
+            const auto length = std::min(path.find_first_of(".["), path.size());
+            const auto token  = path.substr(0, length);
+            std::size_t index;
+            if (token.empty()) {
+                fail(original, position);
+            } else if (token == "*") {
+                node = anyNode(node);
+            } else if (toIndex(token, index)) {
+                node = elementNode(node, index);
+            } else {
+                node = memberNode(node, std::string(token));
+            }
+            path.remove_prefix(length);
+        }
+        if (!path.empty() && path.front() == '.') {
+            path.remove_prefix(1);
+            if (path.empty()) {
+                fail(original, original.size());
+            }
+        }
+    }
+    return node;
+}
+
+Query::Query(const std::vector<std::string_view>& paths): nodes(1), count(paths.size()) {
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        const auto path = paths[i];
+        if (path.empty() || path.front() == '/') {
+            for (const auto node : compilePointer(path)) {
+                nodes[node].paths.push_back(i);
+            }
+        } else {
+            nodes[compilePath(path)].paths.push_back(i);
+        }
+    }
+}
+
+/**
+ * Advances the given cursor behind the separator following an element.
+ *
+ * @param in the cursor, positioned behind the element
+ * @param closing the character closing the container
+ * @throws Exception if neither a separator nor the closing character follows
+ */
+static inline void nextElement(Cursor& in, char closing) {
+    skipWhitespaces(in);
+    if (in.peek() == ',') {
+        in.get();
+        skipWhitespaces(in);
+    } else if (in.peek() != closing) {
+        throw Exception(closing, static_cast<char>(in.peek()), in.tellg());
+    }
+}
+
+void Query::memberSuccessors(const std::vector<std::size_t>& active, std::string_view name,
+                             std::vector<std::size_t>& successors) const {
+    for (const auto node : active) {
+        for (const auto& [member, successor] : nodes[node].members) {
+            if (member == name) {
+                successors.push_back(successor);
+            }
+        }
+        if (nodes[node].any != none) {
+            successors.push_back(nodes[node].any);
+        }
+    }
+}
+
+void Query::elementSuccessors(const std::vector<std::size_t>& active, std::size_t index,
+                              std::vector<std::size_t>& successors) const {
+    for (const auto node : active) {
+        for (const auto& [position, successor] : nodes[node].elements) {
+            if (position == index) {
+                successors.push_back(successor);
+            }
+        }
+        if (nodes[node].any != none) {
+            successors.push_back(nodes[node].any);
+        }
+    }
+}
+
+void Query::matchParsed(const Value& value, const std::vector<std::size_t>& active, const QueryConsumer& consumer) const {
+    for (const auto node : active) {
+        for (const auto path : nodes[node].paths) {
+            auto copy = value;
+            consumer(path, copy);
+        }
+    }
+    std::vector<std::size_t> next;
+    if (const auto object = value.tryAs<ValueType::Object>()) {
+        for (const auto& [name, member] : *object) {
+            next.clear();
+            memberSuccessors(active, name, next);
+            if (!next.empty()) {
+                matchParsed(member, next, consumer);
+            }
+        }
+    } else if (const auto array = value.tryAs<ValueType::Array>()) {
+        for (std::size_t index = 0; index < array->size(); ++index) {
+            next.clear();
+            elementSuccessors(active, index, next);
+            if (!next.empty()) {
+                matchParsed((*array)[index], next, consumer);
+            }
+        }
+    }
+}
+
+void Query::match(Cursor& in, const std::vector<std::size_t>& active, std::size_t depth,
+                  std::vector<std::vector<std::size_t>>& levels, const QueryConsumer& consumer) const {
+    auto matching   = false;
+    auto descending = false;
+    for (const auto node : active) {
+        matching   = matching   || !nodes[node].paths.empty();
+        descending = descending || nodes[node].hasSuccessors();
+    }
+    if (matching) {
+        // The matching value is parsed anyway, so the paths continuing into it are matched on the parsed value.
+        matchParsed(readValue(in), active, consumer);
+        return;
+    }
+    const auto first = in.peek();
+    if (!descending || (first != '{' && first != '[')) {
+        skipValue(in);
+        return;
+    }
+
+    if (levels.size() <= depth) {
+        levels.resize(depth + 1);
+    }
+    in.get();
+    skipWhitespaces(in);
+    const auto closing = first == '{' ? '}' : ']';
+    for (std::size_t index = 0; in.peek() != closing; ++index) {
+        if (in.peek() == EOF) {
+            throw Exception(closing, static_cast<char>(EOF), in.tellg());
+        }
+        auto& next = levels[depth];
+        next.clear();
+        if (first == '{') {
+            bool escaped;
+            const auto raw = readRawString(in, escaped);
+            const auto key = escaped ? decode(in, raw, escaped) : std::string();
+            const auto name = escaped ? std::string_view(key) : raw;
+            expectConsume(in, ':');
+            skipWhitespaces(in);
+            memberSuccessors(active, name, next);
+        } else {
+            elementSuccessors(active, index, next);
+        }
+        if (in.peek() == EOF) {
+            throw Exception(closing, static_cast<char>(EOF), in.tellg());
+        }
+        if (next.empty()) {
+            skipValue(in);
+        } else {
+            // The set is moved out, since nested levels may reallocate the sets.
+            auto successors = std::move(next);
+            match(in, successors, depth + 1, levels, consumer);
+            levels[depth] = std::move(successors);
+        }
+        nextElement(in, closing);
+    }
+    in.get();
+}
+
+void Query::run(std::string_view data, const QueryConsumer& consumer) const {
+    auto in = Cursor(data);
+    skipWhitespaces(in);
+    if (in.peek() == EOF) {
+        throw Exception('{', static_cast<char>(EOF), in.tellg());
+    }
+    std::vector<std::vector<std::size_t>> levels;
+    match(in, { 0 }, 0, levels, consumer);
+}
+
+auto Query::evaluate(std::string_view data) const -> std::vector<std::vector<Value>> {
+    std::vector<std::vector<Value>> toReturn(count);
+    run(data, [&toReturn](std::size_t path, Value& value) {
+        toReturn[path].push_back(std::move(value));
+    });
+    return toReturn;
+}
+}
@@ -0,0 +1,321 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <SimpleJSON/Stats.hpp>
+
+#ifdef SIMPLE_JSON_STATS
+# include <algorithm>
+# include <chrono>
+# include <string>
+# include <string_view>
+
+# include <SimpleJSON/Document.hpp>
+# include <SimpleJSON/parser.hpp>
+# include <SimpleJSON/Reader.hpp>
+
+# include "TreeBuilder.hpp"
+
+namespace simple_json {
+namespace stats {
+thread_local ParseStats* current = nullptr;
+}
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Counts the allocation of the given string, if its content does not fit
+ * into the string itself.
+ *
+ * @param string the string
+ */
+static inline void countAllocation(const std::string& string) {
+    if (string.capacity() > std::string().capacity()) {
+        stats::countAllocation(string.capacity() + 1);
+    }
+}
+
+/**
+ * Creates the values of a parse on the heap like the @c HeapStorage ,
+ * counting the allocations of their strings.
+ */
+struct CountingStorage: HeapStorage {
+    inline auto makeString(std::string_view string) -> Value {
+        auto value = HeapStorage::makeString(string);
+        countAllocation(std::get<std::string>(value.value));
+        return value;
+    }
+
+    inline auto makeKey(std::string_view name) -> std::string {
+        auto key = HeapStorage::makeKey(name);
+        countAllocation(key);
+        return key;
+    }
+};
+
+/**
+ * Creates the values of a parse in the arena of a document like the
+ * @c DocumentStorage , counting the allocations of the keys. The chunks of the
+ * arena are counted by @c allocateOnHeap() .
+ */
+struct CountingDocumentStorage: DocumentStorage {
+    inline auto makeKey(std::string_view name) -> std::string {
+        auto key = DocumentStorage::makeKey(name);
+        countAllocation(key);
+        return key;
+    }
+};
+
+/**
+ * Counts the escape sequences of the string preceding the given closing quote.
+ *
+ * @param begin the beginning of the buffer containing the string
+ * @param closing the closing quote of the string
+ * @return the amount of escape sequences
+ */
+static inline auto countEscapes(const char* begin, const char* closing) -> std::size_t {
+    // The opening quote is the first one not preceded by an odd amount of backslashes.
+    auto opening = closing - 1;
+    for (;; --opening) {
+        if (*opening != '"') {
+            continue;
+        }
+        auto backslash = opening;
+        while (backslash > begin && backslash[-1] == '\\') {
+            --backslash;
+        }
+        if ((opening - backslash) % 2 == 0) {
+            break;
+        }
+    }
+
+    std::size_t count = 0;
+    for (auto current = opening + 1; current < closing; ++current) {
+        if (*current == '\\') {
+            ++count;
+            current += current[1] == 'u' ? 5 : 1;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief A handler collecting the statistics of a parse, passing the parsed
+ * elements on to a tree builder.
+ *
+ * The time spent in the builder is measured for every element.
+ *
+ * @tparam Builder the type of the tree builder
+ */
+template<typename Builder>
+class InstrumentedBuilder {
+    /** The builder the elements are passed to. */
+    Builder& builder;
+    /** The parsed buffer.                      */
+    std::string_view data;
+    /** The cursor the data is read from.       */
+    const Cursor& in;
+    /** The statistics to add to.               */
+    ParseStats& stats;
+    /** The current nesting depth.              */
+    std::size_t depth = 0;
+
+    /**
+     * Counts a value of the given type.
+     *
+     * @param type the type of the value
+     */
+    inline void count(ValueType type) {
+        ++stats.values[static_cast<std::size_t>(type)];
+    }
+
+    /**
+     * Counts the given decoded string, whose closing quote has just been read.
+     *
+     * @param string the decoded string
+     */
+    inline void countString(std::string_view string) {
+        stats.stringBytes += string.size();
+        // Strings with escape sequences are decoded outside of the buffer.
+        if (string.data() < data.data() || string.data() > data.data() + data.size()) {
+            stats.escapes += countEscapes(data.data(), in.position() - 1);
+        }
+    }
+
+    /**
+     * Opens an array or object.
+     */
+    inline void open() {
+        stats.maxDepth = std::max(stats.maxDepth, ++depth);
+    }
+
+    /**
+     * Calls the given function and measures the time spent in it as the time
+     * of building the values.
+     *
+     * @param function the function calling the builder
+     */
+    template<typename Function>
+    inline void build(Function&& function) {
+        const auto start = Clock::now();
+        function();
+        stats.buildTime += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    }
+
+public:
+    /**
+     * Constructs an instrumented handler.
+     *
+     * @param builder the builder to pass the elements to
+     * @param data the parsed buffer
+     * @param in the cursor the data is read from
+     * @param stats the statistics to add to
+     */
+    inline InstrumentedBuilder(Builder& builder, std::string_view data, const Cursor& in, ParseStats& stats):
+        builder(builder), data(data), in(in), stats(stats) {}
+
+    inline void startObject() {
+        count(ValueType::Object);
+        open();
+        build([this] { builder.startObject(); });
+    }
+
+    inline void key(std::string_view name) {
+        countString(name);
+        build([this, name] { builder.key(name); });
+    }
+
+    inline void endObject() {
+        --depth;
+        build([this] { builder.endObject(); });
+    }
+
+    inline void startArray() {
+        count(ValueType::Array);
+        open();
+        build([this] { builder.startArray(); });
+    }
+
+    inline void endArray() {
+        --depth;
+        build([this] { builder.endArray(); });
+    }
+
+    inline void string(std::string_view value) {
+        count(ValueType::String);
+        countString(value);
+        build([this, value] { builder.string(value); });
+    }
+
+    inline void integer(long value) {
+        count(ValueType::Int);
+        build([this, value] { builder.integer(value); });
+    }
+
+    inline void unsignedInteger(unsigned long value) {
+        count(ValueType::UInt);
+        build([this, value] { builder.unsignedInteger(value); });
+    }
+
+    inline void floating(double value) {
+        count(ValueType::Double);
+        build([this, value] { builder.floating(value); });
+    }
+
+    inline void boolean(bool value) {
+        count(ValueType::Bool);
+        build([this, value] { builder.boolean(value); });
+    }
+
+    inline void null() {
+        count(ValueType::Null);
+        build([this] { builder.null(); });
+    }
+};
+
+/**
+ * Collects the statistics of a parse on the current thread while alive,
+ * and adds the consumed bytes and the scanning time when destroyed.
+ */
+class Collection {
+    /** The statistics to add to.                              */
+    ParseStats& stats;
+    /** The cursor the data is read from.                      */
+    const Cursor& in;
+    /** The statistics previously collected on this thread.    */
+    ParseStats* previous;
+    /** The time the parse started.                            */
+    Clock::time_point start;
+    /** The building time of the statistics before the parse. */
+    std::chrono::nanoseconds buildTime;
+
+public:
+    /**
+     * Starts collecting the statistics of a parse.
+     *
+     * @param stats the statistics to add to
+     * @param in the cursor the data is read from
+     */
+    inline Collection(ParseStats& stats, const Cursor& in):
+        stats(stats), in(in), previous(stats::current), start(Clock::now()), buildTime(stats.buildTime) {
+        stats::current = &stats;
+    }
+
+    Collection(const Collection&) = delete;
+    auto operator=(const Collection&) -> Collection& = delete;
+
+    inline ~Collection() {
+        const auto total = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        stats.scanTime += total - (stats.buildTime - buildTime);
+        stats.bytes    += in.consumed();
+        stats::current  = previous;
+    }
+};
+
+/**
+ * Parses the given buffer into the given builder and collects the statistics
+ * of the parse.
+ *
+ * @param data the buffer containing the JSON data
+ * @param builder the tree builder
+ * @param stats the statistics to add to
+ * @return the parsed root value
+ * @throws Exception if the parsing failed
+ * @tparam Storage the storage of the builder
+ */
+template<typename Storage>
+static inline auto parse(std::string_view data, TreeBuilder<Storage>& builder, ParseStats& stats) -> Value {
+    auto in      = Cursor(data);
+    auto handler = InstrumentedBuilder(builder, data, in, stats);
+    {
+        const auto collection = Collection(stats, in);
+        Reader(in, handler).parse();
+    }
+    return std::move(builder).getRoot();
+}
+
+auto parse(std::string_view data, ParseStats& stats) -> Value {
+    auto storage = CountingStorage();
+    auto builder = TreeBuilder(storage);
+    return parse(data, builder, stats);
+}
+
+Document::Document(std::string_view data, ParseStats& stats): data(data) {
+    createArena();
+    auto storage = CountingDocumentStorage { { *arena, data } };
+    auto builder = TreeBuilder(storage);
+    root = simple_json::parse(data, builder, stats);
+}
+}
+#endif
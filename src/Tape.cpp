@@ -0,0 +1,174 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstring>
+#include <utility>
+
+#include <SimpleJSON/Reader.hpp>
+#include <SimpleJSON/Tape.hpp>
+
+namespace simple_json {
+/**
+ * Writes the elements reported by a @c Reader onto a tape.
+ */
+class TapeWriter {
+    /** The entries of the tape.                                          */
+    std::vector<std::uint64_t>& entries;
+    /** The string buffer of the tape.                                    */
+    std::string& strings;
+    /** The start entry and the element count of the open containers.     */
+    std::vector<std::pair<std::size_t, std::uint64_t>> containers;
+
+    /**
+     * Appends an entry to the tape.
+     *
+     * @param type the type of the entry
+     * @param payload the payload of the entry
+     * @return the index of the appended entry
+     */
+    inline auto append(std::uint64_t type, std::uint64_t payload) -> std::size_t {
+        entries.push_back(type << Tape::typeShift | payload);
+        return entries.size() - 1;
+    }
+
+    /**
+     * Appends an entry of the given value type to the tape.
+     *
+     * @param type the type of the entry
+     * @param payload the payload of the entry
+     * @return the index of the appended entry
+     */
+    inline auto append(ValueType type, std::uint64_t payload) -> std::size_t {
+        return append(static_cast<std::uint64_t>(type), payload);
+    }
+
+    /**
+     * Appends the entry of a value, counting it as element of the innermost
+     * open container.
+     *
+     * @param type the type of the value
+     * @param payload the payload of the entry
+     */
+    inline void appendValue(ValueType type, std::uint64_t payload) {
+        if (!containers.empty()) {
+            ++containers.back().second;
+        }
+        append(type, payload);
+    }
+
+    /**
+     * Appends the given string to the string buffer.
+     *
+     * @param string the decoded string
+     * @return the offset of the string in the string buffer
+     */
+    inline auto writeString(std::string_view string) -> std::uint64_t {
+        const auto offset = strings.size();
+        const auto length = static_cast<std::uint32_t>(string.size());
+
+        strings.resize(offset + sizeof(std::uint32_t) + string.size());
+        std::memcpy(strings.data() + offset, &length, sizeof(length));
+        std::memcpy(strings.data() + offset + sizeof(std::uint32_t), string.data(), string.size());
+        return offset;
+    }
+
+    /**
+     * Opens an array or object.
+     *
+     * @param type the type of the container
+     */
+    inline void open(ValueType type) {
+        appendValue(type, 0);
+        containers.emplace_back(entries.size() - 1, 0);
+    }
+
+    /**
+     * @brief Closes the innermost open container.
+     *
+     * The start entry is updated to point to the end entry, which contains
+     * the amount of elements.
+     */
+    inline void close() {
+        const auto [start, count] = containers.back();
+        containers.pop_back();
+        const auto end = append(Tape::endMarker, count);
+        entries[start] |= end;
+    }
+
+public:
+    /**
+     * Constructs a writer for the given tape contents.
+     *
+     * @param entries the entries of the tape
+     * @param strings the string buffer of the tape
+     */
+    inline TapeWriter(std::vector<std::uint64_t>& entries, std::string& strings):
+        entries(entries), strings(strings) {}
+
+    inline void startObject() { open(ValueType::Object); }
+    inline void endObject()   { close();                 }
+    inline void startArray()  { open(ValueType::Array);  }
+    inline void endArray()    { close();                 }
+
+    inline void key(std::string_view name) {
+        append(ValueType::String, writeString(name));
+    }
+
+    inline void string(std::string_view value) {
+        appendValue(ValueType::String, writeString(value));
+    }
+
+    inline void integer(long value) {
+        appendValue(ValueType::Int, 0);
+        entries.push_back(static_cast<std::uint64_t>(value));
+    }
+
+    inline void unsignedInteger(unsigned long value) {
+        appendValue(ValueType::UInt, 0);
+        entries.push_back(value);
+    }
+
+    inline void floating(double value) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        appendValue(ValueType::Double, 0);
+        entries.push_back(bits);
+    }
+
+    inline void boolean(bool value) {
+        appendValue(ValueType::Bool, value);
+    }
+
+    inline void null() {
+        appendValue(ValueType::Null, 0);
+    }
+};
+
+void Tape::parse(std::string_view data) {
+    entries.reserve(data.size() / 8 + 16);
+    strings.reserve(data.size() / 2 + 16);
+
+    auto writer = TapeWriter(entries, strings);
+    simple_json::parse(data, writer);
+}
+
+Tape::Tape(std::string_view data) {
+    parse(data);
+}
+
+Tape::Tape(std::istream& stream) {
+    parse(readAll(stream));
+}
+}
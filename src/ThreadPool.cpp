@@ -0,0 +1,129 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include <SimpleJSON/ThreadPool.hpp>
+
+namespace simple_json {
+/** The pool the current thread belongs to, if any.   */
+static thread_local const ThreadPool* currentPool = nullptr;
+/** The index of the current thread within its pool. */
+static thread_local std::size_t currentIndex = 0;
+
+ThreadPool::ThreadPool(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < threads; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    this->threads.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        this->threads.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    const auto index = currentPool == this ? currentIndex : next.fetch_add(1) % queues.size();
+    {
+        auto& queue = *queues[index];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        ++queued;
+    }
+    // A searching thread finds the task. A thread going to sleep stops
+    // searching before checking for tasks, so it either sees the task or
+    // is seen here.
+    if (searching == 0) {
+        wake();
+    }
+}
+
+void ThreadPool::wake() {
+    if (idle > 0) {
+        // Waits for a thread going to sleep to start waiting.
+        { std::lock_guard lock(mutex); }
+        condition.notify_one();
+    }
+}
+
+auto ThreadPool::take(std::size_t index, std::function<void()>& task) -> bool {
+    {
+        auto& own = *queues[index];
+        std::lock_guard lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            --queued;
+            return true;
+        }
+    }
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+        auto& other = *queues[(index + i) % queues.size()];
+        std::lock_guard lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.back());
+            other.tasks.pop_back();
+            --queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run(std::size_t index) {
+    currentPool  = this;
+    currentIndex = index;
+
+    std::function<void()> task;
+    ++searching;
+    for (;;) {
+        if (take(index, task)) {
+            // The last searching thread hands the search over to a sleeping one.
+            if (--searching == 0 && queued > 0) {
+                wake();
+            }
+            task();
+            task = nullptr;
+            ++searching;
+            continue;
+        }
+        // The tasks are counted while their queue is locked, so a counted
+        // task is in a queue: it was missed by the scan and is taken next.
+        std::unique_lock lock(mutex);
+        --searching;
+        ++idle;
+        condition.wait(lock, [this] { return stopping || queued > 0; });
+        --idle;
+        ++searching;
+        if (queued == 0) {
+            return;
+        }
+    }
+}
+}
@@ -0,0 +1,214 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_TreeBuilder_hpp
+#define SimpleJSON_TreeBuilder_hpp
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/Arena.hpp>
+#include <SimpleJSON/Value.hpp>
+
+/**
+ * @file TreeBuilder.hpp
+ *
+ * The handler building trees of values and the storages creating them.
+ */
+
+namespace simple_json {
+/**
+ * Creates the values of a parse on the heap, owning their strings.
+ */
+struct HeapStorage {
+    /**
+     * Creates a string value from the given decoded string.
+     *
+     * @param string the decoded string
+     * @return the string as @c Value
+     */
+    inline auto makeString(std::string_view string) -> Value {
+        return Value { ValueType::String, std::string(string) };
+    }
+
+    /**
+     * Creates the key of an object member.
+     *
+     * @param name the decoded key
+     * @return the key
+     */
+    inline auto makeKey(std::string_view name) -> std::string {
+        return std::string(name);
+    }
+
+    inline auto makeArray()  -> ArrayContent  { return ArrayContent();  }
+    inline auto makeObject() -> ObjectContent { return ObjectContent(); }
+};
+
+/**
+ * Creates the values of a parse inside of the arena of a @c Document .
+ * Strings are borrowed from the input buffer, strings containing escape
+ * sequences are copied into the arena once decoded.
+ */
+struct DocumentStorage {
+    /** The arena of the document. */
+    Arena& arena;
+    /** The input buffer.          */
+    std::string_view data;
+
+    /**
+     * Creates a string value from the given decoded string.
+     *
+     * @param string the decoded string
+     * @return the string as @c Value
+     */
+    inline auto makeString(std::string_view string) -> Value {
+        if (string.data() >= data.data() && string.data() + string.size() <= data.data() + data.size()) {
+            return Value { ValueType::String, string };
+        }
+        const auto buffer = static_cast<char*>(arena.allocate(string.size(), 1));
+        std::memcpy(buffer, string.data(), string.size());
+        return Value { ValueType::String, std::string_view(buffer, string.size()) };
+    }
+
+    /**
+     * Creates the key of an object member.
+     *
+     * @param name the decoded key
+     * @return the key
+     */
+    inline auto makeKey(std::string_view name) -> std::string {
+        return std::string(name);
+    }
+
+    inline auto makeArray()  -> ArrayContent  { return ArrayContent(&arena);  }
+    inline auto makeObject() -> ObjectContent { return ObjectContent(&arena); }
+};
+
+/**
+ * @brief Builds a tree of values from the elements reported by a @c Reader .
+ *
+ * The builder can be reused for multiple trees; the built value is taken
+ * using @c getRoot() .
+ *
+ * @tparam Storage the storage creating the values and containers
+ */
+template<typename Storage>
+class TreeBuilder {
+    /** The storage creating the values.          */
+    Storage& storage;
+    /** The currently open arrays and objects.    */
+    std::vector<Value> containers;
+    /** The pending key of each open object.      */
+    std::vector<std::string> keys;
+    /** The completely built value.               */
+    Value root;
+
+    /**
+     * Adds the given value to the innermost open container.
+     *
+     * @param value the value to add
+     */
+    inline void add(Value&& value) {
+        if (containers.empty()) {
+            root = std::move(value);
+            return;
+        }
+        auto& top = containers.back();
+        if (top.is(ValueType::Object)) {
+            std::get<ObjectContent>(top.value).set(std::move(keys.back()), std::move(value));
+        } else {
+            std::get<ArrayContent>(top.value).push_back(std::move(value));
+        }
+    }
+
+    /**
+     * Closes the innermost open container.
+     */
+    inline void close() {
+        auto value = std::move(containers.back());
+        containers.pop_back();
+        add(std::move(value));
+    }
+
+public:
+    /**
+     * Constructs a builder using the given storage.
+     *
+     * @param storage the storage creating the values
+     */
+    inline explicit TreeBuilder(Storage& storage): storage(storage) {}
+
+    inline void startObject() {
+        containers.push_back(Value { ValueType::Object, storage.makeObject() });
+        keys.emplace_back();
+    }
+
+    inline void key(std::string_view name) {
+        keys.back() = storage.makeKey(name);
+    }
+
+    inline void endObject() {
+        keys.pop_back();
+        close();
+    }
+
+    inline void startArray() {
+        containers.push_back(Value { ValueType::Array, storage.makeArray() });
+    }
+
+    inline void endArray() {
+        close();
+    }
+
+    inline void string(std::string_view value) {
+        add(storage.makeString(value));
+    }
+
+    inline void integer(long value) {
+        add(Value { ValueType::Int, value });
+    }
+
+    inline void unsignedInteger(unsigned long value) {
+        add(Value { ValueType::UInt, value });
+    }
+
+    inline void floating(double value) {
+        add(Value { ValueType::Double, value });
+    }
+
+    inline void boolean(bool value) {
+        add(Value { ValueType::Bool, value });
+    }
+
+    inline void null() {
+        add(Value { ValueType::Null, 0 });
+    }
+
+    /**
+     * Returns the built value.
+     *
+     * @return the root value
+     */
+    inline auto getRoot() && -> Value {
+        return std::move(root);
+    }
+};
+}
+
+#endif /* SimpleJSON_TreeBuilder_hpp */
@@ -0,0 +1,28 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <SimpleJSON/Validator.hpp>
+
+namespace simple_json {
+auto validate(std::string_view data) -> std::optional<Error> {
+    auto handler   = NullHandler();
+    auto in        = Cursor(data);
+    auto validator = Validator(in, handler);
+    if (validator.tryValidate()) {
+        return std::nullopt;
+    }
+    return validator.getError();
+}
+}
@@ -0,0 +1,165 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/Cursor.hpp>
+#include <SimpleJSON/Reader.hpp>
+#include <SimpleJSON/ValueStream.hpp>
+
+#include "TreeBuilder.hpp"
+
+namespace simple_json {
+/**
+ * Creates the values of a parse on the heap, reusing the containers and
+ * strings of previously parsed values.
+ */
+class RecyclingStorage {
+    /** The emptied arrays available for reuse.  */
+    std::vector<ArrayContent> arrays;
+    /** The emptied objects available for reuse. */
+    std::vector<ObjectContent> objects;
+    /** The strings available for reuse.         */
+    std::vector<std::string> strings;
+
+    /**
+     * Creates a string with the given content, reusing a string if available.
+     *
+     * @param content the content of the string
+     * @return the string
+     */
+    inline auto takeString(std::string_view content) -> std::string {
+        if (strings.empty()) {
+            return std::string(content);
+        }
+        auto toReturn = std::move(strings.back());
+        strings.pop_back();
+        toReturn.assign(content);
+        return toReturn;
+    }
+
+public:
+    inline auto makeString(std::string_view string) -> Value {
+        return Value { ValueType::String, takeString(string) };
+    }
+
+    inline auto makeKey(std::string_view name) -> std::string {
+        return takeString(name);
+    }
+
+    inline auto makeArray() -> ArrayContent {
+        if (arrays.empty()) {
+            return ArrayContent();
+        }
+        auto toReturn = std::move(arrays.back());
+        arrays.pop_back();
+        return toReturn;
+    }
+
+    inline auto makeObject() -> ObjectContent {
+        if (objects.empty()) {
+            return ObjectContent();
+        }
+        auto toReturn = std::move(objects.back());
+        objects.pop_back();
+        return toReturn;
+    }
+
+    /**
+     * @brief Takes the containers and strings of the given value for reuse.
+     *
+     * Containers shared with copies of the value are left alone.
+     *
+     * @param value the value to dismantle
+     */
+    void recycle(Value&& value) {
+        // The type is not consulted, it is indeterminate in default-initialized values.
+        if (const auto string = std::get_if<std::string>(&value.value)) {
+            strings.push_back(std::move(*string));
+        } else if (const auto array = std::get_if<ArrayContent>(&value.value)) {
+            if (array->isShared()) {
+                return;
+            }
+            for (auto element = array->mutableBegin(); element != array->mutableEnd(); ++element) {
+                recycle(std::move(*element));
+            }
+            array->clear();
+            arrays.push_back(std::move(*array));
+        } else if (const auto object = std::get_if<ObjectContent>(&value.value)) {
+            if (object->isShared()) {
+                return;
+            }
+            for (auto member = object->mutableBegin(); member != object->mutableEnd(); ++member) {
+                strings.push_back(std::move(member->first));
+                recycle(std::move(member->second));
+            }
+            object->clear();
+            objects.push_back(std::move(*object));
+        }
+    }
+};
+
+/**
+ * The state of a value stream, which is kept at a stable address.
+ */
+struct ValueStream::State {
+    /** The input buffer if owned by the stream.  */
+    std::string buffer;
+    /** The cursor reading the data.             */
+    Cursor in;
+    /** The storage recycling the values.         */
+    RecyclingStorage storage;
+    /** The handler building the values.          */
+    TreeBuilder<RecyclingStorage> builder;
+    /** The reader reporting to the builder.      */
+    Reader<TreeBuilder<RecyclingStorage>> reader;
+
+    /**
+     * Constructs the state for the given data.
+     *
+     * @param buffer the owned buffer, if any
+     * @param data the data if the buffer is borrowed
+     * @param offset the position of the data in the original input
+     */
+    inline State(std::string&& buffer, std::string_view data, long long offset):
+        buffer(std::move(buffer)), in(this->buffer.empty() ? data : this->buffer, offset), builder(storage), reader(in, builder) {}
+};
+
+ValueStream::ValueStream(std::string_view data, long long offset): state(std::make_unique<State>(std::string(), data, offset)) {}
+
+ValueStream::ValueStream(std::istream& stream): state(std::make_unique<State>(readAll(stream), std::string_view(), 0)) {}
+
+ValueStream::ValueStream(ValueStream&&) noexcept = default;
+auto ValueStream::operator=(ValueStream&&) noexcept -> ValueStream& = default;
+ValueStream::~ValueStream() = default;
+
+auto ValueStream::next(Value& value) -> bool {
+    auto& in = state->in;
+    skipWhitespaces(in);
+    if (in.peek() == EOF) {
+        return false;
+    }
+    state->storage.recycle(std::move(value));
+    state->reader.parseValue();
+    value = std::move(state->builder).getRoot();
+    return true;
+}
+
+auto ValueStream::getPosition() const -> std::size_t {
+    return state->in.consumed();
+}
+}
@@ -0,0 +1,281 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+#include <SimpleJSON/scanner.hpp>
+#include <SimpleJSON/Writer.hpp>
+
+namespace simple_json {
+/** The size of the buffer in bytes above which it is passed to the sink. */
+static constexpr std::size_t drainSize = 1 << 16;
+
+Writer::Writer(const WriterOptions& options): options(options) {}
+
+Writer::Writer(Sink sink, const WriterOptions& options): sink(std::move(sink)), options(options) {
+    buffer.reserve(drainSize + drainSize / 4);
+}
+
+Writer::Writer(std::ostream& stream, const WriterOptions& options): Writer([&stream](std::string_view data) {
+    stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+}, options) {}
+
+Writer::Writer(Writer&& other):
+    buffer(std::move(other.buffer)), sink(std::move(other.sink)), options(other.options),
+    empty(std::move(other.empty)), afterKey(other.afterKey) {
+    // The data is passed to the sink by this writer only.
+    other.buffer.clear();
+}
+
+auto Writer::operator=(Writer&& other) -> Writer& {
+    if (this != &other) {
+        flush();
+        buffer   = std::move(other.buffer);
+        sink     = std::move(other.sink);
+        options  = other.options;
+        empty    = std::move(other.empty);
+        afterKey = other.afterKey;
+        other.buffer.clear();
+    }
+    return *this;
+}
+
+Writer::~Writer() {
+    try {
+        flush();
+    } catch (...) {
+        // The exceptions of the sink cannot be reported here.
+    }
+}
+
+void Writer::drain() {
+    if (sink && buffer.size() >= drainSize) {
+        sink(buffer);
+        buffer.clear();
+    }
+}
+
+void Writer::flush() {
+    if (sink && !buffer.empty()) {
+        sink(buffer);
+        buffer.clear();
+    }
+}
+
+void Writer::newLine() {
+    buffer.push_back('\n');
+    buffer.append(empty.size() * options.indent, ' ');
+}
+
+void Writer::separate() {
+    if (afterKey) {
+        afterKey = false;
+        return;
+    }
+    if (empty.empty()) {
+        return;
+    }
+    if (empty.back()) {
+        empty.back() = false;
+    } else {
+        buffer.push_back(',');
+    }
+    if (options.pretty) {
+        newLine();
+    }
+}
+
+void Writer::writeString(std::string_view string) {
+    static constexpr char hex[] = "0123456789abcdef";
+
+    buffer.push_back('"');
+    auto current   = string.data();
+    const auto end = current + string.size();
+    while (current < end) {
+        const auto special = scanner::findEscapable(current, end);
+        buffer.append(current, special);
+        if (special == end) {
+            break;
+        }
+        const auto character = static_cast<unsigned char>(*special);
+        switch (character) {
+            case '"':  buffer.append("\\\""); break;
+            case '\\': buffer.append("\\\\"); break;
+            case '\b': buffer.append("\\b");  break;
+            case '\f': buffer.append("\\f");  break;
+            case '\n': buffer.append("\\n");  break;
+            case '\r': buffer.append("\\r");  break;
+            case '\t': buffer.append("\\t");  break;
+
+            default: {
+                const char escape[] = { '\\', 'u', '0', '0', hex[character >> 4], hex[character & 0xf] };
+                buffer.append(escape, sizeof(escape));
+                break;
+            }
+        }
+        current = special + 1;
+    }
+    buffer.push_back('"');
+}
+
+void Writer::startObject() {
+    separate();
+    buffer.push_back('{');
+    empty.push_back(true);
+}
+
+void Writer::key(std::string_view name) {
+    separate();
+    writeString(name);
+    if (options.pretty) {
+        buffer.append(": ");
+    } else {
+        buffer.push_back(':');
+    }
+    afterKey = true;
+}
+
+void Writer::endObject() {
+    const auto wasEmpty = empty.back();
+    empty.pop_back();
+    if (options.pretty && !wasEmpty) {
+        newLine();
+    }
+    buffer.push_back('}');
+    drain();
+}
+
+void Writer::startArray() {
+    separate();
+    buffer.push_back('[');
+    empty.push_back(true);
+}
+
+void Writer::endArray() {
+    const auto wasEmpty = empty.back();
+    empty.pop_back();
+    if (options.pretty && !wasEmpty) {
+        newLine();
+    }
+    buffer.push_back(']');
+    drain();
+}
+
+void Writer::string(std::string_view value) {
+    separate();
+    writeString(value);
+    drain();
+}
+
+void Writer::integer(long value) {
+    separate();
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+    drain();
+}
+
+void Writer::unsignedInteger(unsigned long value) {
+    separate();
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+    drain();
+}
+
+void Writer::floating(double value) {
+    if (!std::isfinite(value)) {
+        null();
+        return;
+    }
+    separate();
+    char digits[32];
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+#else
+    const auto end = digits + std::snprintf(digits, sizeof(digits), "%.17g", value);
+#endif
+    buffer.append(digits, end);
+    // Keeps the number a floating point number when read again.
+    if (std::find_if(digits, end, [](char c) { return c == '.' || c == 'e'; }) == end) {
+        buffer.append(".0");
+    }
+    drain();
+}
+
+void Writer::boolean(bool value) {
+    separate();
+    buffer.append(value ? "true" : "false");
+    drain();
+}
+
+void Writer::null() {
+    separate();
+    buffer.append("null");
+    drain();
+}
+
+void Writer::object(const ObjectContent& content) {
+    startObject();
+    for (const auto& [name, member] : content) {
+        key(name);
+        value(member);
+    }
+    endObject();
+}
+
+void Writer::array(const ArrayContent& content) {
+    startArray();
+    for (const auto& element : content) {
+        value(element);
+    }
+    endArray();
+}
+
+void Writer::value(const Value& value) {
+    switch (value.type) {
+        case ValueType::Int:    integer(value.as<ValueType::Int>());          break;
+        case ValueType::String: string(value.asStringView());                  break;
+        case ValueType::Array:  array(value.as<ValueType::Array>());           break;
+        case ValueType::Bool:   boolean(value.as<ValueType::Bool>());          break;
+        case ValueType::Object: object(value.as<ValueType::Object>());         break;
+        case ValueType::Null:   null();                                        break;
+        case ValueType::UInt:   unsignedInteger(value.as<ValueType::UInt>()); break;
+        case ValueType::Double: floating(value.as<ValueType::Double>());      break;
+    }
+}
+
+auto serialize(const Value& value, const WriterOptions& options) -> std::string {
+    Writer writer(options);
+    writer.value(value);
+    return writer.take();
+}
+
+auto serialize(const ObjectContent& content, const WriterOptions& options) -> std::string {
+    Writer writer(options);
+    writer.object(content);
+    return writer.take();
+}
+
+auto serialize(const ArrayContent& content, const WriterOptions& options) -> std::string {
+    Writer writer(options);
+    writer.array(content);
+    return writer.take();
+}
+}
@@ -13,169 +13,205 @@
  * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
  */
 
-#include <SimpleJSON/Exception.hpp>
+#include <algorithm>
+#include <string>
+
+#include <SimpleJSON/Document.hpp>
 #include <SimpleJSON/parser.hpp>
+#include <SimpleJSON/PushReader.hpp>
+#include <SimpleJSON/Reader.hpp>
+#include <SimpleJSON/Validator.hpp>
+
+#include "TreeBuilder.hpp"
 
 namespace simple_json {
-/**
- * Skips the next whitespaces in the given input stream.
- *
- * @param in the input stream
- */
-static inline void skipWhitespaces(std::istream& in) {
-    while (std::isspace(in.peek())) {
-        in.get();
-    }
+auto readValue(Cursor& in) -> Value {
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    Reader(in, builder).parseValue();
+    return std::move(builder).getRoot();
 }
 
 /**
- * Expects the next character in the given stream to be the given one.
+ * Finds the offending character in the given malformed block.
  *
- * @param in the input stream
- * @param expected the expected character
- * @param skipWhite whether to skip remaining whitespaces before checking the character
- * @throws Exception if the character is not the expected one
+ * @param buffer the valid data preceding the block
+ * @param block the block
+ * @param size the size of the block
+ * @return the index of the offending character
  */
-static inline void expect(std::istream& in, char expected, bool skipWhite = true) {
-    if (skipWhite) {
-        skipWhitespaces(in);
+static auto findError(const std::string& buffer, const char* block, std::size_t size) -> std::size_t {
+    auto handler = NullHandler();
+    auto reader  = PushReader<NullHandler>(handler);
+    std::size_t index = 0;
+    try {
+        reader.feed(buffer);
+        for (; index < size; ++index) {
+            reader.feed(block + index, 1);
+        }
+    } catch (const Exception&) {}
+    return std::min(index, size - 1);
+}
+
+auto readValueData(std::istream& in) -> std::string {
+    if (in.tellg() >= 0) {
+        return readAll(in);
     }
-    if (in.peek() != expected) {
-        throw Exception(expected, static_cast<char>(in.peek()), in.tellg());
+    std::string buffer;
+    auto buf = in.rdbuf();
+    if (buf == nullptr) {
+        return buffer;
     }
+    // The value is read in blocks out of the buffer of the stream, the
+    // characters following it are put back.
+    auto handler = NullHandler();
+    auto reader  = PushReader<NullHandler>(handler);
+    char block[4096];
+    while (!reader.isDone()) {
+        if (std::char_traits<char>::eq_int_type(buf->sgetc(), std::char_traits<char>::eof())) {
+            in.setstate(std::ios_base::eofbit);
+            break;
+        }
+        const auto available = buf->in_avail();
+        const auto buffered  = available > 0;
+        std::size_t size = 1;
+        if (buffered) {
+            size = static_cast<std::size_t>(buf->sgetn(block, std::min<std::streamsize>(available, sizeof(block))));
+        } else {
+            // Unbuffered streams are read one character at a time.
+            block[0] = std::char_traits<char>::to_char_type(buf->sgetc());
+        }
+        std::size_t consumed;
+        auto failed = false;
+        try {
+            consumed = reader.feed(block, size);
+        } catch (const Exception&) {
+            // The data ends with the offending character, so the caller reports the same error.
+            consumed = findError(buffer, block, size) + 1;
+            failed   = true;
+        }
+        buffer.append(block, consumed);
+        if (buffered) {
+            for (auto i = size; i > consumed; --i) {
+                buf->sputbackc(block[i - 1]);
+            }
+        } else if (consumed > 0) {
+            buf->sbumpc();
+        }
+        if (failed) {
+            break;
+        }
+    }
+    return buffer;
 }
 
-/**
- * @brief Expects the next character in the given stream to be the given one.
- *
- * The expected character is consumed if found.
- *
- * @param in the input stream
- * @param expected the expected character
- * @param skipWhite whether to skip remaining whitespaces before checking the character
- * @throws Exception if the character is not the expected one
- */
-static inline void expectConsume(std::istream& in, char expected, bool skipWhite = true) {
-    expect(in, expected, skipWhite);
-    in.get();
+auto parse(std::string_view data) -> Value {
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    parse(data, builder);
+    return std::move(builder).getRoot();
 }
 
-/**
- * Reads a string surrounded by quotes.
- *
- * @param in the input stream to read from
- * @return the read string as @c Value
- */
-static inline auto readString(std::istream& in) -> Value {
-    expectConsume(in, '"');
+auto parse(std::istream& stream) -> Value {
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    parse(stream, builder);
+    return std::move(builder).getRoot();
+}
 
-    std::string buffer;
-    while (in.peek() != '"') {
-        if (in.peek() == '\\') in.get();
-        buffer += static_cast<char>(in.get());
+auto tryParse(std::string_view data) -> Result<Value> {
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    auto in      = Cursor(data);
+    auto reader  = Reader(in, builder);
+    if (!reader.tryParse()) {
+        return reader.getError();
     }
-    expectConsume(in, '"');
-    return Value { ValueType::String, buffer };
+    return std::move(builder).getRoot();
 }
 
-/**
- * Reads a primitive value from the given stream.
- *
- * Primitives are numbers (parsed as base 10), @c true, @c false and @c null .
- *
- * @param in the input stream
- * @return the read primitive as @c Value
- */
-static inline auto readPrimitive(std::istream& in) -> Value {
-    std::string buffer;
-    while (!std::isspace(in.peek()) && in.peek() != ',' && in.peek() != ']' && in.peek() != '}') {
-        buffer += static_cast<char>(in.get());
+auto tryParse(std::istream& stream) -> Result<Value> {
+    const auto start  = static_cast<long long>(stream.tellg());
+    const auto buffer = readValueData(stream);
+
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    auto in      = Cursor(buffer, start < 0 ? 0 : start);
+    auto reader  = Reader(in, builder);
+    const auto success = reader.tryParse();
+    if (start >= 0) {
+        // Like other streams, a failed stream is positioned behind the offending character.
+        const auto consumed = success ? in.consumed() : std::min(in.consumed() + 1, buffer.size());
+        stream.clear();
+        stream.seekg(start + static_cast<long long>(consumed));
     }
-    if (buffer == "true" || buffer == "false") {
-        return Value { ValueType::Bool, buffer == "true" };
-    } else if (buffer == "null") {
-        return Value { ValueType::Null, 0 };
+    if (!success) {
+        stream.setstate(std::ios_base::failbit);
+        return reader.getError();
     }
-    return Value { ValueType::Int, std::strtol(buffer.c_str(), nullptr, 10) };
+    return std::move(builder).getRoot();
 }
 
-/**
- * Parses a JSON object surrounded by curly brackets.
- *
- * @param in the input stream
- * @return the parsed object as @c Value
- */
-static inline auto readObject(std::istream& in) -> Value;
+auto parseStrict(std::string_view data) -> Value {
+    auto storage = HeapStorage();
+    auto builder = TreeBuilder(storage);
+    auto in      = Cursor(data);
+    Validator(in, builder).validate();
+    return std::move(builder).getRoot();
+}
 
-/**
- * @brief Parses a JSON array surrounded by square brackets.
- *
- * JSON arrays may contain any kind of JSON value, including a mixture of types.
- *
- * @param in the input stream
- * @return the parsed array as @c Value
- */
-static inline auto readArray(std::istream& in) -> Value {
-    expectConsume(in, '[');
-    skipWhitespaces(in);
-    auto content = std::vector<Value>();
-    while (in.peek() != ']') {
-        Value value;
-        switch (in.peek()) {
-            case '"': value = readString(in); break;
-            case '[': value = readArray(in);  break;
-            case '{': value = readObject(in); break;
-
-            default: value = readPrimitive(in); break;
-        }
-        content.push_back(value);
-        skipWhitespaces(in);
-        if (in.peek() == ',') {
-            in.get();
-            skipWhitespaces(in);
-        }
+auto tryParseStrict(std::string_view data) -> Result<Value> {
+    auto storage   = HeapStorage();
+    auto builder   = TreeBuilder(storage);
+    auto in        = Cursor(data);
+    auto validator = Validator(in, builder);
+    if (!validator.tryValidate()) {
+        return validator.getError();
     }
-    expectConsume(in, ']');
-    return Value { ValueType::Array, content };
-}
-
-static inline auto readObject(std::istream& in) -> Value {
-    skipWhitespaces(in);
-    expectConsume(in, '{');
-
-    auto toReturn = std::map<std::string, Value>();
-    skipWhitespaces(in);
-    while (in.peek() != '}') {
-        auto name = readString(in);
-        expectConsume(in, ':');
-        skipWhitespaces(in);
-        Value value;
-        switch (in.peek()) {
-            case '"': value = readString(in); break;
-            case '[': value = readArray(in);  break;
-            case '{': value = readObject(in); break;
-
-            default: value = readPrimitive(in); break;
-        }
-        toReturn.emplace(std::make_pair(std::get<std::string>(name.value), value));
-        skipWhitespaces(in);
-        if (in.peek() == ',') {
-            in.get();
-            skipWhitespaces(in);
-        }
-    }
-    expectConsume(in, '}');
-    return { ValueType::Object, toReturn };
+    return std::move(builder).getRoot();
 }
 
-auto parse(std::istream& in) -> Value {
-    skipWhitespaces(in);
+void Document::createArena() {
+    // The arena only holds the containers and the decoded strings, a fraction of the data; it grows as needed.
+    arena = std::make_unique<Arena>(std::clamp(data.size() / 4, std::size_t(4096), std::size_t(1) << 20));
+}
 
-    switch (in.peek()) {
-        case '{': return readObject(in);
-        case '[': return readArray(in);
+void Document::parse() {
+    createArena();
+    auto storage = DocumentStorage { *arena, data };
+    auto builder = TreeBuilder(storage);
+    simple_json::parse(data, builder);
+    root = std::move(builder).getRoot();
+}
+
+Document::Document(std::string_view data): data(data) {
+    parse();
+}
+
+Document::Document(std::string&& data):
+    buffer(std::make_unique<std::string>(std::move(data))), data(*buffer) {
+    parse();
+}
+
+Document::Document(std::istream& stream):
+    buffer(std::make_unique<std::string>(readAll(stream))), data(*buffer) {
+    parse();
+}
+
+Document::Document(MappedFile&& file): file(std::move(file)), data(this->file.getData()) {
+    parse();
+}
 
-        default: throw Exception('{', char(in.peek()), in.tellg());
+auto Document::operator=(Document&& other) noexcept -> Document& {
+    if (this != &other) {
+        // The values need to be released before the arena containing them.
+        root   = Value();
+        arena  = std::move(other.arena);
+        buffer = std::move(other.buffer);
+        file   = std::move(other.file);
+        data   = other.data;
+        root   = std::move(other.root);
     }
+    return *this;
 }
 }
@@ -0,0 +1,667 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstring>
+
+#include <SimpleJSON/scanner.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+# include <immintrin.h>
+# define SIMPLE_JSON_X86 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+# define SIMPLE_JSON_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+# define SIMPLE_JSON_TARGET_AVX2
+#endif
+
+namespace simple_json::scanner {
+/**
+ * The functions implementing the scanner for a specific instruction set.
+ */
+struct Implementation {
+    /** The name of the instruction set.            */
+    const char* name;
+    /** The block classification function.          */
+    auto (*classify)(const char*) -> Block;
+    /** The whitespace skipping function.           */
+    auto (*skipWhitespaceRun)(const char*, const char*) -> const char*;
+    /** The quote and backslash searching function. */
+    auto (*findQuoteOrBackslash)(const char*, const char*) -> const char*;
+    /** The escapable character searching function. */
+    auto (*findEscapable)(const char*, const char*) -> const char*;
+    /** The UTF-8 validation function.              */
+    auto (*validateUtf8)(const char*, const char*) -> const char*;
+};
+
+/**
+ * Returns the amount of trailing zero bits in the given value.
+ *
+ * @param value the value, must not be zero
+ * @return the amount of trailing zero bits
+ */
+static inline auto trailingZeros(std::uint64_t value) -> int {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    int count = 0;
+    for (; (value & 1) == 0; value >>= 1) ++count;
+    return count;
+#endif
+}
+
+/**
+ * Classifies the given character into the given block masks.
+ *
+ * @param c the character to classify
+ * @param bit the bit representing the position of the character
+ * @param block the block to be updated
+ */
+static inline void classify(char c, std::uint64_t bit, Block& block) {
+    switch (c) {
+        case '"':  block.quotes      |= bit; break;
+        case '\\': block.backslashes |= bit; break;
+
+        case '{': case '}': case '[': case ']': case ':': case ',':
+            block.structurals |= bit;
+            break;
+
+        case ' ': case '\n': case '\r': case '\t':
+            block.whitespaces |= bit;
+            break;
+
+        default: break;
+    }
+}
+
+[[maybe_unused]]
+static auto classifyFallback(const char* block) -> Block {
+    auto toReturn = Block {};
+    for (std::size_t i = 0; i < blockSize; ++i) {
+        classify(block[i], std::uint64_t(1) << i, toReturn);
+    }
+    return toReturn;
+}
+
+static auto skipWhitespaceRunFallback(const char* begin, const char* end) -> const char* {
+    while (begin < end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+static auto findQuoteOrBackslashFallback(const char* begin, const char* end) -> const char* {
+    while (begin < end && *begin != '"' && *begin != '\\') {
+        ++begin;
+    }
+    return begin;
+}
+
+static auto findEscapableFallback(const char* begin, const char* end) -> const char* {
+    while (begin < end && *begin != '"' && *begin != '\\' && static_cast<unsigned char>(*begin) >= 0x20) {
+        ++begin;
+    }
+    return begin;
+}
+
+/**
+ * Returns the length of the valid UTF-8 sequence starting at the given position.
+ *
+ * @param begin the first byte of the sequence
+ * @param end the end of the input
+ * @return the length of the sequence or @c 0 if it is invalid
+ */
+static inline auto sequenceLength(const char* begin, const char* end) -> int {
+    const auto bytes = reinterpret_cast<const unsigned char*>(begin);
+    const auto lead  = bytes[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+    int length;
+    unsigned char low = 0x80, high = 0xbf;
+    if (lead < 0xc2) {
+        return 0;
+    } else if (lead < 0xe0) {
+        length = 2;
+    } else if (lead < 0xf0) {
+        length = 3;
+        if      (lead == 0xe0) low  = 0xa0;
+        else if (lead == 0xed) high = 0x9f;
+    } else if (lead < 0xf5) {
+        length = 4;
+        if      (lead == 0xf0) low  = 0x90;
+        else if (lead == 0xf4) high = 0x8f;
+    } else {
+        return 0;
+    }
+    if (end - begin < length || bytes[1] < low || bytes[1] > high) {
+        return 0;
+    }
+    for (int i = 2; i < length; ++i) {
+        if ((bytes[i] & 0xc0) != 0x80) {
+            return 0;
+        }
+    }
+    return length;
+}
+
+static auto validateUtf8Fallback(const char* begin, const char* end) -> const char* {
+    while (begin < end) {
+        const auto length = sequenceLength(begin, end);
+        if (length == 0) {
+            return begin;
+        }
+        begin += length;
+    }
+    return end;
+}
+
+#ifdef SIMPLE_JSON_X86
+/**
+ * Returns a mask of the JSON whitespaces in the given chunk.
+ *
+ * @param chunk the chunk of 16 bytes
+ * @return the whitespace mask
+ */
+static inline auto whitespaces(__m128i chunk) -> std::uint64_t {
+    const auto spaces = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+    const auto others = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')),
+                                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(spaces, others)));
+}
+
+/**
+ * Returns a mask of the characters <tt>{}[]:,</tt> in the given chunk.
+ *
+ * @param chunk the chunk of 16 bytes
+ * @return the structural character mask
+ */
+static inline auto structurals(__m128i chunk) -> std::uint64_t {
+    const auto curly = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('{')),
+                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('}')));
+    const auto square = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('[')),
+                                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8(']')));
+    const auto separators = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')),
+                                         _mm_cmpeq_epi8(chunk, _mm_set1_epi8(',')));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(curly, square), separators)));
+}
+
+static auto classifySSE2(const char* block) -> Block {
+    auto toReturn = Block {};
+    for (std::size_t i = 0; i < blockSize; i += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        toReturn.quotes      |= std::uint64_t(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')))))  << i;
+        toReturn.backslashes |= std::uint64_t(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))))) << i;
+        toReturn.structurals |= structurals(chunk) << i;
+        toReturn.whitespaces |= whitespaces(chunk) << i;
+    }
+    return toReturn;
+}
+
+static auto skipWhitespaceRunSSE2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 16; begin += 16) {
+        const auto others = ~whitespaces(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin))) & 0xffff;
+        if (others != 0) {
+            return begin + trailingZeros(others);
+        }
+    }
+    return skipWhitespaceRunFallback(begin, end);
+}
+
+static auto findQuoteOrBackslashSSE2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 16; begin += 16) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        const auto mask  = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                                        _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+        if (const auto found = static_cast<std::uint32_t>(_mm_movemask_epi8(mask))) {
+            return begin + trailingZeros(found);
+        }
+    }
+    return findQuoteOrBackslashFallback(begin, end);
+}
+
+/**
+ * Returns a mask of the characters to be escaped in a JSON string in the given chunk.
+ *
+ * @param chunk the chunk
+ * @return the escapable character mask
+ */
+static inline auto escapables(__m128i chunk) -> std::uint32_t {
+    const auto control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8(0x1f)), _mm_set1_epi8(0x1f));
+    const auto special = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                                      _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(control, special)));
+}
+
+static auto findEscapableSSE2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 16; begin += 16) {
+        if (const auto found = escapables(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)))) {
+            return begin + trailingZeros(found);
+        }
+    }
+    return findEscapableFallback(begin, end);
+}
+
+static auto validateUtf8SSE2(const char* begin, const char* end) -> const char* {
+    while (end - begin >= 16) {
+        const auto others = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin))));
+        if (others == 0) {
+            begin += 16;
+            continue;
+        }
+        // Validates the sequences up to the next ASCII character.
+        begin += trailingZeros(others);
+        do {
+            const auto length = sequenceLength(begin, end);
+            if (length == 0) {
+                return begin;
+            }
+            begin += length;
+        } while (begin < end && static_cast<unsigned char>(*begin) >= 0x80);
+    }
+    return validateUtf8Fallback(begin, end);
+}
+
+/**
+ * Returns a mask of the JSON whitespaces in the given chunk.
+ *
+ * @param chunk the chunk of 32 bytes
+ * @return the whitespace mask
+ */
+SIMPLE_JSON_TARGET_AVX2
+static inline auto whitespaces(__m256i chunk) -> std::uint64_t {
+    const auto spaces = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')),
+                                        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')));
+    const auto others = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r')),
+                                        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t')));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(spaces, others)));
+}
+
+/**
+ * Returns a mask of the characters <tt>{}[]:,</tt> in the given chunk.
+ *
+ * @param chunk the chunk of 32 bytes
+ * @return the structural character mask
+ */
+SIMPLE_JSON_TARGET_AVX2
+static inline auto structurals(__m256i chunk) -> std::uint64_t {
+    const auto curly = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('{')),
+                                       _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('}')));
+    const auto square = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('[')),
+                                        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(']')));
+    const auto separators = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')),
+                                            _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(',')));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(curly, square), separators)));
+}
+
+SIMPLE_JSON_TARGET_AVX2
+static auto classifyAVX2(const char* block) -> Block {
+    auto toReturn = Block {};
+    for (std::size_t i = 0; i < blockSize; i += 32) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+        toReturn.quotes      |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"')))))  << i;
+        toReturn.backslashes |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\'))))) << i;
+        toReturn.structurals |= structurals(chunk) << i;
+        toReturn.whitespaces |= whitespaces(chunk) << i;
+    }
+    return toReturn;
+}
+
+SIMPLE_JSON_TARGET_AVX2
+static auto skipWhitespaceRunAVX2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 32; begin += 32) {
+        const auto others = ~whitespaces(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin))) & 0xffffffff;
+        if (others != 0) {
+            return begin + trailingZeros(others);
+        }
+    }
+    return skipWhitespaceRunSSE2(begin, end);
+}
+
+SIMPLE_JSON_TARGET_AVX2
+static auto findQuoteOrBackslashAVX2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 32; begin += 32) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        const auto mask  = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"')),
+                                           _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+        if (const auto found = static_cast<std::uint32_t>(_mm256_movemask_epi8(mask))) {
+            return begin + trailingZeros(found);
+        }
+    }
+    return findQuoteOrBackslashSSE2(begin, end);
+}
+
+/**
+ * Returns a mask of the characters to be escaped in a JSON string in the given chunk.
+ *
+ * @param chunk the chunk
+ * @return the escapable character mask
+ */
+SIMPLE_JSON_TARGET_AVX2
+static inline auto escapables(__m256i chunk) -> std::uint32_t {
+    const auto control = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, _mm256_set1_epi8(0x1f)), _mm256_set1_epi8(0x1f));
+    const auto special = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"')),
+                                         _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(control, special)));
+}
+
+SIMPLE_JSON_TARGET_AVX2
+static auto findEscapableAVX2(const char* begin, const char* end) -> const char* {
+    for (; end - begin >= 32; begin += 32) {
+        if (const auto found = escapables(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin)))) {
+            return begin + trailingZeros(found);
+        }
+    }
+    return findEscapableSSE2(begin, end);
+}
+
+/*
+ * The error classes of the UTF-8 validation by lookup tables, indexed by the
+ * high and the low nibble of a byte and by the high nibble of the following
+ * byte. A pair of bytes is invalid if the classes of all three lookups share
+ * a bit.
+ */
+/** A lead byte is not followed by a continuation byte.      */
+static constexpr std::uint8_t tooShort     = 1 << 0;
+/** A continuation byte follows an ASCII character.          */
+static constexpr std::uint8_t tooLong      = 1 << 1;
+/** A three byte sequence is an overlong encoding.           */
+static constexpr std::uint8_t overlong3    = 1 << 2;
+/** A four byte sequence encodes a code point above U+10FFFF. */
+static constexpr std::uint8_t tooLarge     = 1 << 3;
+/** A three byte sequence encodes a surrogate.               */
+static constexpr std::uint8_t surrogate    = 1 << 4;
+/** A two byte sequence is an overlong encoding.             */
+static constexpr std::uint8_t overlong2    = 1 << 5;
+/** A four byte sequence is too large, starting with 1000.   */
+static constexpr std::uint8_t tooLarge1000 = 1 << 6;
+/** A four byte sequence is an overlong encoding.            */
+static constexpr std::uint8_t overlong4    = 1 << 6;
+/** Two continuation bytes follow each other.                */
+static constexpr std::uint8_t twoConts     = 1 << 7;
+/** The classes not depending on the low nibble of a byte.   */
+static constexpr std::uint8_t carry        = tooShort | tooLong | twoConts;
+
+/** The error classes by the high nibble of the first byte.  */
+alignas(16) static constexpr std::uint8_t firstHighClasses[16] = {
+    tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+    twoConts, twoConts, twoConts, twoConts,
+    tooShort | overlong2,
+    tooShort,
+    tooShort | overlong3 | surrogate,
+    tooShort | tooLarge | tooLarge1000 | overlong4
+};
+
+/** The error classes by the low nibble of the first byte.   */
+alignas(16) static constexpr std::uint8_t firstLowClasses[16] = {
+    carry | overlong3 | overlong2 | overlong4,
+    carry | overlong2,
+    carry,
+    carry,
+    carry | tooLarge,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000 | surrogate,
+    carry | tooLarge | tooLarge1000,
+    carry | tooLarge | tooLarge1000
+};
+
+/** The error classes by the high nibble of the second byte. */
+alignas(16) static constexpr std::uint8_t secondHighClasses[16] = {
+    tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+    tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4,
+    tooLong | overlong2 | twoConts | overlong3 | tooLarge,
+    tooLong | overlong2 | twoConts | surrogate | tooLarge,
+    tooLong | overlong2 | twoConts | surrogate | tooLarge,
+    tooShort, tooShort, tooShort, tooShort
+};
+
+/**
+ * Loads the given table of 16 bytes into both lanes of a vector.
+ *
+ * @param table the table
+ * @return the vector containing the table twice
+ */
+SIMPLE_JSON_TARGET_AVX2
+static inline auto loadTable(const std::uint8_t (&table)[16]) -> __m256i {
+    return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+/**
+ * Returns the given chunk shifted by the given amount of bytes, filled with
+ * the last bytes of the previous chunk.
+ *
+ * @param chunk the chunk
+ * @param previous the previous chunk
+ * @tparam N the amount of bytes to shift by, at most 16
+ * @return the bytes preceding each byte of the chunk by @c N bytes
+ */
+template<int N>
+SIMPLE_JSON_TARGET_AVX2
+static inline auto preceding(__m256i chunk, __m256i previous) -> __m256i {
+    return _mm256_alignr_epi8(chunk, _mm256_permute2x128_si256(previous, chunk, 0x21), 16 - N);
+}
+
+/**
+ * Returns a vector with bytes unequal to zero where the given chunk contains
+ * invalid UTF-8 sequences, including sequences started in the previous chunk.
+ *
+ * @param chunk the chunk of 32 bytes
+ * @param previous the previous chunk
+ * @return the error vector
+ */
+SIMPLE_JSON_TARGET_AVX2
+static inline auto utf8Errors(__m256i chunk, __m256i previous) -> __m256i {
+    const auto nibble  = _mm256_set1_epi8(0x0f);
+    const auto first   = preceding<1>(chunk, previous);
+    const auto special = _mm256_and_si256(
+        _mm256_and_si256(_mm256_shuffle_epi8(loadTable(firstHighClasses), _mm256_and_si256(_mm256_srli_epi16(first, 4), nibble)),
+                         _mm256_shuffle_epi8(loadTable(firstLowClasses),  _mm256_and_si256(first, nibble))),
+        _mm256_shuffle_epi8(loadTable(secondHighClasses), _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble)));
+
+    // Bytes two behind a three byte lead or three behind a four byte lead need to be continuation bytes.
+    const auto third  = _mm256_subs_epu8(preceding<2>(chunk, previous), _mm256_set1_epi8(char(0xe0 - 0x80)));
+    const auto fourth = _mm256_subs_epu8(preceding<3>(chunk, previous), _mm256_set1_epi8(char(0xf0 - 0x80)));
+    const auto mustContinue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(char(0x80)));
+    return _mm256_xor_si256(mustContinue, special);
+}
+
+/**
+ * Returns the beginning of the character containing the given byte, assuming
+ * the bytes before it are valid UTF-8.
+ *
+ * @param begin the beginning of the input
+ * @param position the byte
+ * @return the first byte of the character
+ */
+static inline auto characterStart(const char* begin, const char* position) -> const char* {
+    for (int i = 0; i < 3 && position > begin && (static_cast<unsigned char>(*position) & 0xc0) == 0x80; ++i) {
+        --position;
+    }
+    return position;
+}
+
+SIMPLE_JSON_TARGET_AVX2
+static auto validateUtf8AVX2(const char* begin, const char* end) -> const char* {
+    const auto start = begin;
+    auto previous = _mm256_setzero_si256();
+    for (; end - begin >= 32; begin += 32) {
+        const auto chunk  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        const auto errors = utf8Errors(chunk, previous);
+        if (!_mm256_testz_si256(errors, errors)) {
+            break;
+        }
+        previous = chunk;
+    }
+    // The exact position of an error and the rest of the input are found by the scalar validation,
+    // starting with the character continued in the current chunk.
+    return validateUtf8Fallback(begin == start ? start : characterStart(start, begin - 1), end);
+}
+
+/**
+ * Returns whether the running processor supports AVX2.
+ *
+ * @return whether AVX2 instructions can be used
+ */
+static inline auto hasAVX2() -> bool {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+#endif
+
+/**
+ * Chooses the best implementation for the running processor.
+ *
+ * @return the chosen implementation
+ */
+static inline auto chooseImplementation() -> Implementation {
+#ifdef SIMPLE_JSON_X86
+    if (hasAVX2()) {
+        return { "avx2", classifyAVX2, skipWhitespaceRunAVX2, findQuoteOrBackslashAVX2, findEscapableAVX2,
+                 validateUtf8AVX2 };
+    }
+    return { "sse2", classifySSE2, skipWhitespaceRunSSE2, findQuoteOrBackslashSSE2, findEscapableSSE2, validateUtf8SSE2 };
+#else
+    return { "fallback", classifyFallback, skipWhitespaceRunFallback, findQuoteOrBackslashFallback, findEscapableFallback,
+             validateUtf8Fallback };
+#endif
+}
+
+/**
+ * Returns the implementation used by the scanner functions.
+ *
+ * @return the implementation for the running processor
+ */
+static inline auto implementation() -> const Implementation& {
+    static const auto toReturn = chooseImplementation();
+    return toReturn;
+}
+
+/**
+ * @brief Computes the mask of the characters escaped by a backslash.
+ *
+ * Only odd-length sequences of backslashes escape the following character.
+ *
+ * @param backslashes the backslash mask of the current block
+ * @param previousEscaped whether the first character of the block is escaped,
+ * set for the following block
+ * @return the mask of the escaped characters
+ */
+static inline auto findEscaped(std::uint64_t backslashes, std::uint64_t& previousEscaped) -> std::uint64_t {
+    if (backslashes == 0) {
+        const auto toReturn = previousEscaped;
+        previousEscaped = 0;
+        return toReturn;
+    }
+    constexpr auto evenBits = std::uint64_t(0x5555555555555555);
+
+    backslashes &= ~previousEscaped;
+    const auto followsEscape  = backslashes << 1 | previousEscaped;
+    const auto oddStarts      = backslashes & ~evenBits & ~followsEscape;
+    const auto evenSequences  = oddStarts + backslashes;
+    previousEscaped = evenSequences < oddStarts ? 1 : 0;
+    const auto invertMask     = evenSequences << 1;
+    return (evenBits ^ invertMask) & followsEscape;
+}
+
+/**
+ * Computes the prefix XOR of the given mask.
+ *
+ * @param mask the mask
+ * @return a mask with each bit being the XOR of all lower bits of the given mask
+ */
+static inline auto prefixXor(std::uint64_t mask) -> std::uint64_t {
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+auto classify(const char* block) -> Block {
+    return implementation().classify(block);
+}
+
+auto skipWhitespaceRun(const char* begin, const char* end) -> const char* {
+    return implementation().skipWhitespaceRun(begin, end);
+}
+
+auto findQuoteOrBackslash(const char* begin, const char* end) -> const char* {
+    return implementation().findQuoteOrBackslash(begin, end);
+}
+
+auto findEscapable(const char* begin, const char* end) -> const char* {
+    return implementation().findEscapable(begin, end);
+}
+
+auto validateUtf8(const char* begin, const char* end) -> const char* {
+    return implementation().validateUtf8(begin, end);
+}
+
+auto indexStructurals(std::string_view data, std::vector<std::size_t>& positions) -> bool {
+    auto state = IndexState {};
+    indexStructurals(data, positions, state);
+    return state.inString == 0;
+}
+
+void indexStructurals(std::string_view data, std::vector<std::size_t>& positions, IndexState& state) {
+    auto& previousEscaped  = state.escaped;
+    auto& previousInString = state.inString;
+    char padded[blockSize];
+
+    for (std::size_t offset = 0; offset < data.size(); offset += blockSize) {
+        auto block = data.data() + offset;
+        if (data.size() - offset < blockSize) {
+            std::memset(padded, ' ', blockSize);
+            std::memcpy(padded, block, data.size() - offset);
+            block = padded;
+        }
+        const auto masks   = implementation().classify(block);
+        const auto escaped = findEscaped(masks.backslashes, previousEscaped);
+        const auto inString = prefixXor(masks.quotes & ~escaped) ^ previousInString;
+        previousInString = inString >> 63 != 0 ? ~std::uint64_t(0) : 0;
+
+        for (auto structurals = masks.structurals & ~inString; structurals != 0; structurals &= structurals - 1) {
+            positions.push_back(offset + static_cast<std::size_t>(trailingZeros(structurals)));
+        }
+    }
+}
+
+auto implementationName() -> const char* {
+    return implementation().name;
+}
+}
@@ -0,0 +1,156 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstring>
+
+#include <SimpleJSON/scanner.hpp>
+#include <SimpleJSON/strings.hpp>
+
+namespace simple_json::strings {
+/**
+ * Reads four hexadecimal digits.
+ *
+ * @param begin the first digit
+ * @param end the end of the input
+ * @param result set to the read value
+ * @return whether four valid digits were read
+ */
+static inline auto readHex(const char* begin, const char* end, unsigned& result) -> bool {
+    if (end - begin < 4) {
+        return false;
+    }
+    result = 0;
+    for (int i = 0; i < 4; ++i) {
+        const auto c = begin[i];
+        result <<= 4;
+        if      (c >= '0' && c <= '9') result |= unsigned(c - '0');
+        else if (c >= 'a' && c <= 'f') result |= unsigned(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') result |= unsigned(c - 'A' + 10);
+        else return false;
+    }
+    return true;
+}
+
+/**
+ * Encodes the given code point as UTF-8.
+ *
+ * @param codePoint the code point to encode
+ * @param out the output buffer
+ * @return the end of the encoded character
+ */
+static inline auto encode(unsigned codePoint, char* out) -> char* {
+    if (codePoint < 0x80) {
+        *out++ = static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        *out++ = static_cast<char>(0xc0 | codePoint >> 6);
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3f));
+    } else if (codePoint < 0x10000) {
+        *out++ = static_cast<char>(0xe0 | codePoint >> 12);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3f));
+    } else {
+        *out++ = static_cast<char>(0xf0 | codePoint >> 18);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 12 & 0x3f));
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    return out;
+}
+
+/**
+ * @brief Decodes a @c \\u escape sequence.
+ *
+ * Surrogate pairs spanning two escape sequences are combined.
+ *
+ * @param begin the first hexadecimal digit, set behind the decoded sequence
+ * @param end the end of the input
+ * @param out the output buffer
+ * @return the end of the decoded character or @c nullptr if the sequence is invalid
+ */
+static inline auto decodeUnicode(const char*& begin, const char* end, char* out) -> char* {
+    unsigned codePoint;
+    if (!readHex(begin, end, codePoint)) {
+        return nullptr;
+    }
+    begin += 4;
+    if (codePoint >= 0xd800 && codePoint < 0xdc00) {
+        unsigned low;
+        if (end - begin >= 6 && begin[0] == '\\' && begin[1] == 'u' && readHex(begin + 2, end, low)
+            && low >= 0xdc00 && low < 0xe000) {
+            begin += 6;
+            codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+        } else {
+            codePoint = 0xfffd;
+        }
+    } else if (codePoint >= 0xdc00 && codePoint < 0xe000) {
+        codePoint = 0xfffd;
+    }
+    return encode(codePoint, out);
+}
+
+auto findEnd(const char* begin, const char* end, bool& escaped) -> const char* {
+    escaped = false;
+    for (;;) {
+        begin = scanner::findQuoteOrBackslash(begin, end);
+        if (begin == end || *begin == '"') {
+            return begin;
+        }
+        escaped = true;
+        if (end - begin < 2) {
+            return end;
+        }
+        begin += 2;
+    }
+}
+
+auto unescape(const char*& begin, const char* end, char* out) -> char* {
+    while (begin < end) {
+        const auto escape = scanner::findQuoteOrBackslash(begin, end);
+        std::memcpy(out, begin, static_cast<std::size_t>(escape - begin));
+        out  += escape - begin;
+        begin = escape;
+        if (begin == end) {
+            break;
+        }
+        if (*begin != '\\' || end - begin < 2) {
+            return nullptr;
+        }
+        switch (begin[1]) {
+            case '"':  *out++ = '"';  break;
+            case '\\': *out++ = '\\'; break;
+            case '/':  *out++ = '/';  break;
+            case 'b':  *out++ = '\b'; break;
+            case 'f':  *out++ = '\f'; break;
+            case 'n':  *out++ = '\n'; break;
+            case 'r':  *out++ = '\r'; break;
+            case 't':  *out++ = '\t'; break;
+
+            case 'u': {
+                auto digits = begin + 2;
+                if (auto next = decodeUnicode(digits, end, out)) {
+                    out   = next;
+                    begin = digits;
+                    continue;
+                }
+                return nullptr;
+            }
+
+            default: return nullptr;
+        }
+        begin += 2;
+    }
+    return out;
+}
+}
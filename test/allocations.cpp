@@ -0,0 +1,89 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "allocations.hpp"
+
+namespace simple_json::test {
+/** The amount of allocations made so far.                                   */
+static std::atomic<std::size_t> allocations { 0 };
+/** The amount of allocations until the failing one, negative if none fails. */
+static std::atomic<long> remaining { -1 };
+/** Whether the failing allocation has happened.                             */
+static std::atomic<bool> failed { false };
+
+AllocationCounter::AllocationCounter(): start(allocations) {}
+
+auto AllocationCounter::getCount() const -> std::size_t {
+    return allocations - start;
+}
+
+FailingAllocation::FailingAllocation(std::size_t index) {
+    failed    = false;
+    remaining = static_cast<long>(index);
+}
+
+FailingAllocation::~FailingAllocation() {
+    remaining = -1;
+}
+
+auto FailingAllocation::hasFailed() const -> bool {
+    return failed;
+}
+
+/**
+ * Allocates a block of the given size unless it is the failing allocation.
+ *
+ * @param size the size of the block
+ * @return the block or @c nullptr if the allocation failed
+ */
+static inline auto allocate(std::size_t size) -> void* {
+    if (remaining.load(std::memory_order_relaxed) >= 0 && remaining-- == 0) {
+        failed = true;
+        return nullptr;
+    }
+    ++allocations;
+    return std::malloc(size == 0 ? 1 : size);
+}
+}
+
+auto operator new(std::size_t size) -> void* {
+    if (const auto block = simple_json::test::allocate(size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return operator new(size);
+}
+
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return simple_json::test::allocate(size);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return simple_json::test::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept                          { std::free(pointer); }
+void operator delete[](void* pointer) noexcept                        { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept             { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept           { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept   { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
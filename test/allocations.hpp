@@ -0,0 +1,70 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_test_allocations_hpp
+#define SimpleJSON_test_allocations_hpp
+
+#include <cstddef>
+
+namespace simple_json::test {
+/**
+ * @brief Counts the allocations made while in scope.
+ *
+ * The tests replace the global @c operator @c new , which counts every
+ * allocation.
+ */
+class AllocationCounter {
+    /** The amount of allocations made before the construction. */
+    std::size_t start;
+
+public:
+    AllocationCounter();
+
+    /**
+     * Returns the amount of allocations made since the construction.
+     *
+     * @return the amount of allocations
+     */
+    auto getCount() const -> std::size_t;
+};
+
+/**
+ * @brief Makes an allocation fail while in scope.
+ *
+ * The global @c operator @c new of the tests throws @c std::bad_alloc for
+ * the allocation of the given index, counted from the construction.
+ */
+class FailingAllocation {
+public:
+    /**
+     * Makes the allocation of the given index fail.
+     *
+     * @param index the index of the failing allocation, zero for the next one
+     */
+    explicit FailingAllocation(std::size_t index);
+    FailingAllocation(const FailingAllocation&) = delete;
+    auto operator=(const FailingAllocation&) -> FailingAllocation& = delete;
+    ~FailingAllocation();
+
+    /**
+     * Returns whether the allocation has failed.
+     *
+     * @return whether @c std::bad_alloc was thrown
+     */
+    auto hasFailed() const -> bool;
+};
+}
+
+#endif /* SimpleJSON_test_allocations_hpp */
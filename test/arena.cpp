@@ -0,0 +1,77 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(arenaAlignsAllocations) {
+    auto arena = Arena(64);
+    std::vector<std::pair<unsigned char*, std::size_t>> allocations;
+    for (std::size_t i = 0; i < 200; ++i) {
+        const auto size      = i % 13 == 0 ? 1000 + i : 1 + i % 40;
+        const auto alignment = std::size_t(1) << i % 7;
+        const auto memory    = static_cast<unsigned char*>(arena.allocate(size, alignment));
+        CHECK(reinterpret_cast<std::uintptr_t>(memory) % alignment == 0);
+        std::memset(memory, static_cast<int>(i), size);
+        allocations.emplace_back(memory, size);
+    }
+    // Large allocations got chunks of their own, no allocation overlaps another one.
+    for (std::size_t i = 0; i < allocations.size(); ++i) {
+        const auto [memory, size] = allocations[i];
+        for (std::size_t j = 0; j < size; ++j) {
+            CHECK(memory[j] == static_cast<unsigned char>(i));
+        }
+    }
+    arena.release();
+    CHECK(arena.allocate(16) != nullptr);
+}
+
+SIMPLE_JSON_TEST(arenaAllocatorCopiesUseTheHeap) {
+    auto arena   = Arena();
+    auto numbers = std::vector<int, Allocator<int>>(Allocator<int>(&arena));
+    for (int i = 0; i < 1000; ++i) {
+        numbers.push_back(i);
+    }
+    CHECK(numbers.get_allocator().getArena() == &arena);
+
+    const auto copy = numbers;
+    CHECK(copy.get_allocator().getArena() == nullptr);
+    CHECK(copy == numbers);
+    CHECK(Allocator<int>() != Allocator<char>(&arena));
+}
+
+SIMPLE_JSON_TEST(documentAllocatesInItsArena) {
+    const auto document = Document(R"([{"a": [1, 2]}, "escaped \" string", [[]]])");
+    const auto& array = std::get<ArrayContent>(document.getRoot().value);
+    CHECK(array.get_allocator().getArena() != nullptr);
+    CHECK(std::get<ObjectContent>(array.at(0).value).get_allocator().getArena() == array.get_allocator().getArena());
+    CHECK(array.at(1).asStringView() == "escaped \" string");
+
+    // Copies are allocated on the heap.
+    const auto copy = document.getRoot().as<ValueType::Array>();
+    CHECK(copy.get_allocator().getArena() == nullptr);
+    CHECK(dump(Value { ValueType::Array, copy }) == dump(document.getRoot()));
+}
@@ -0,0 +1,122 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+namespace {
+struct Point {
+    double x = 0;
+    double y = 0;
+};
+
+struct Shape {
+    std::string name = "unnamed";
+    std::vector<Point> points;
+    std::optional<Point> center;
+    std::vector<bool> flags;
+    std::int8_t layer = -1;
+    unsigned long id  = 0;
+    bool visible      = false;
+    Value extra;
+};
+}
+
+template<>
+struct simple_json::Binding<Point> {
+    static constexpr auto fields = simple_json::fields(SIMPLE_JSON_FIELD(Point, x), SIMPLE_JSON_FIELD(Point, y));
+};
+
+template<>
+struct simple_json::Binding<Shape> {
+    static constexpr auto fields = simple_json::fields(SIMPLE_JSON_FIELD(Shape, name),
+                                                       SIMPLE_JSON_FIELD(Shape, points),
+                                                       SIMPLE_JSON_FIELD(Shape, center),
+                                                       SIMPLE_JSON_FIELD(Shape, flags),
+                                                       SIMPLE_JSON_FIELD(Shape, layer),
+                                                       simple_json::field("identifier", &Shape::id),
+                                                       SIMPLE_JSON_FIELD(Shape, visible),
+                                                       SIMPLE_JSON_FIELD(Shape, extra));
+};
+
+SIMPLE_JSON_TEST(bindingReadsAllFields) {
+    const auto shape = parse<Shape>(R"({
+        "name": "triangle",
+        "points": [{"x": 1, "y": 2.5}, {"y": -3}, {}],
+        "center": {"x": 18446744073709551615, "y": 1e2},
+        "flags": [true, false, true],
+        "layer": -128,
+        "identifier": 18446744073709551615,
+        "visible": true,
+        "extra": {"any": ["json", null]}
+    })");
+    CHECK(shape.name == "triangle");
+    CHECK(shape.points.size() == 3);
+    CHECK(shape.points[0].x == 1 && shape.points[0].y == 2.5);
+    CHECK(shape.points[1].x == 0 && shape.points[1].y == -3);
+    CHECK(shape.points[2].x == 0 && shape.points[2].y == 0);
+    CHECK(shape.center && shape.center->x == 18446744073709551615.0 && shape.center->y == 100);
+    CHECK(shape.flags == std::vector<bool>({ true, false, true }));
+    CHECK(shape.layer == -128);
+    CHECK(shape.id == 18446744073709551615UL);
+    CHECK(shape.visible);
+    CHECK(dump(shape.extra) == dump(parse(R"({"any": ["json", null]})")));
+}
+
+SIMPLE_JSON_TEST(bindingKeepsMissingAndSkipsUnknownFields) {
+    const auto shape = parse<Shape>(R"({"unknown": {"points": [1, 2], "name": "inner"}, "center": null,
+                                        "identifier": 7, "more": [[{"x": "}"}]]})");
+    CHECK(shape.name == "unnamed");
+    CHECK(shape.points.empty());
+    CHECK(!shape.center);
+    CHECK(shape.layer == -1);
+    CHECK(shape.id == 7);
+    CHECK(!shape.visible);
+}
+
+SIMPLE_JSON_TEST(bindingRejectsMismatchingTypes) {
+    for (const auto* invalid : {
+        R"({"name": 1})", R"({"points": {}})", R"({"points": [1]})", R"({"center": "here"})", R"({"flags": [1]})",
+        R"({"layer": 128})", R"({"layer": -129})", R"({"layer": 1.5})", R"({"identifier": -1})",
+        R"({"identifier": 18446744073709551616})", R"({"visible": "true"})", R"({"visible": nul})",
+        R"({"center": nil})", R"([])", R"({"name": "a")", R"({"points": [{})",
+        R"({"flags": [true)"
+    }) {
+        CHECK_THROWS(parse<Shape>(invalid), Exception);
+    }
+    CHECK_THROWS(parse<std::vector<Point>>(R"([{"x": 1}, null])"), Exception);
+}
+
+SIMPLE_JSON_TEST(bindingParsesStreams) {
+    auto stream = std::istringstream(R"([{"x": 1}, {"y": 2}] [{"x": 3}])");
+    const auto first = parse<std::vector<Point>>(stream);
+    CHECK(first.size() == 2 && first[0].x == 1 && first[1].y == 2);
+    const auto second = parse<std::vector<Point>>(stream);
+    CHECK(second.size() == 1 && second[0].x == 3);
+
+    const auto temporary = parse<Point>(std::istringstream(R"({"x": 4, "y": 5})"));
+    CHECK(temporary.x == 4 && temporary.y == 5);
+}
@@ -0,0 +1,82 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <new>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "allocations.hpp"
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(compactCopiesAreDeep) {
+    const auto data = R"({"short": "abc", "long": "a string too long to be stored inline", "array": [1, [2.5, null]]})";
+    const auto original = parseCompact(data);
+    auto copy = original;
+    CHECK(dump(copy) == dump(original));
+
+    auto assigned = parseCompact("[true]");
+    assigned = copy;
+    copy     = CompactValue();
+    CHECK(dump(assigned) == dump(parse(data)));
+}
+
+SIMPLE_JSON_TEST(compactObjectAccessors) {
+    const auto value  = parseCompact(R"({"inline": "fourteen bytes", "outline": "fifteen bytes!!", "n": 18446744073709551615,
+                                         "nested": {"a": [1, -2]}, "a": 1, "a": 2})");
+    const auto object = value.as<ValueType::Object>();
+    CHECK(object.size() == 6);
+    CHECK(object.getBang<ValueType::String>("inline") == "fourteen bytes");
+    CHECK(object.getBang<ValueType::String>("outline") == "fifteen bytes!!");
+    CHECK(object.getBang<ValueType::UInt>("n") == 18446744073709551615UL);
+    CHECK(object.getObjectBang("nested").getBang<ValueType::Array>("a").at(1).as<ValueType::Int>() == -2);
+    CHECK(object.getBang<ValueType::Int>("a") == 2);
+    CHECK(!object.get<ValueType::Int>("missing").has_value());
+    CHECK(!object.getObject("missing").has_value());
+    CHECK_THROWS(object.getObject("inline"), std::bad_variant_access);
+    CHECK(object.find("missing") == nullptr);
+    CHECK_THROWS(object.getBang<ValueType::Int>("inline"), std::bad_variant_access);
+}
+
+SIMPLE_JSON_TEST(compactCopyAssignmentIsExceptionSafe) {
+    const auto source = parseCompact(R"(["a string too long to be stored inline", ["another string stored out of line"], {"k": "v"}])");
+    const auto expected = dump(source);
+    for (std::size_t index = 0;; ++index) {
+        auto target = parseCompact(R"({"old": "a string too long to be stored inline"})");
+        const auto old = dump(target);
+        auto failed = false;
+        {
+            auto failing = FailingAllocation(index);
+            try {
+                target = source;
+            } catch (const std::bad_alloc&) {
+                failed = true;
+            }
+            CHECK(failed == failing.hasFailed());
+        }
+        // A failed assignment leaves the target untouched.
+        CHECK(dump(target) == (failed ? old : expected));
+        CHECK(dump(source) == expected);
+        if (!failed) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,322 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdio>
+#include <random>
+
+#include "corpus.hpp"
+
+namespace simple_json::test {
+/**
+ * Generates random JSON documents.
+ */
+class Generator {
+    /** The source of randomness. */
+    std::mt19937_64 random;
+
+    inline auto below(std::size_t bound) -> std::size_t {
+        return static_cast<std::size_t>(random() % bound);
+    }
+
+    void string(std::string& out) {
+        static const char* const pieces[] = {
+            "a", "key", "Hello, World!", "\\\"", "\\\\", "\\/", "\\b\\f\\n\\r\\t", "\\u0041", "\\u00e9",
+            "\\ud83d\\ude00", "é", "€", "\xf0\x9f\x98\x80", " ", "0123456789abcde"
+        };
+        out += '"';
+        for (auto count = below(6); count > 0; --count) {
+            out += pieces[below(sizeof(pieces) / sizeof(*pieces))];
+        }
+        out += '"';
+    }
+
+    void number(std::string& out) {
+        static const char* const numbers[] = {
+            "0", "-0", "1", "-1", "42", "9223372036854775807", "-9223372036854775808", "9223372036854775808",
+            "18446744073709551615", "0.5", "-1.25", "1e10", "1E-5", "6.02214076e23", "-0.0", "123456.789",
+            "2.2250738585072014e-308", "1.7976931348623157e308"
+        };
+        out += numbers[below(sizeof(numbers) / sizeof(*numbers))];
+    }
+
+    void value(std::string& out, int depth) {
+        switch (depth <= 0 ? below(4) : below(7)) {
+            case 0: string(out); break;
+            case 1: number(out); break;
+            case 2: out += below(2) == 0 ? "true" : "false"; break;
+            case 3: out += "null"; break;
+            case 4:
+            case 5: array(out, depth - 1); break;
+            default: object(out, depth - 1); break;
+        }
+    }
+
+    void whitespace(std::string& out) {
+        static const char* const spaces[] = { "", "", "", " ", "\n", "\t  ", "\r\n" };
+        out += spaces[below(sizeof(spaces) / sizeof(*spaces))];
+    }
+
+public:
+    inline explicit Generator(std::uint64_t seed): random(seed) {}
+
+    void array(std::string& out, int depth) {
+        out += '[';
+        for (auto count = below(6), i = std::size_t(0); i < count; ++i) {
+            whitespace(out);
+            if (i > 0) {
+                out += ',';
+                whitespace(out);
+            }
+            value(out, depth);
+        }
+        whitespace(out);
+        out += ']';
+    }
+
+    void object(std::string& out, int depth) {
+        out += '{';
+        for (auto count = below(12), i = std::size_t(0); i < count; ++i) {
+            whitespace(out);
+            if (i > 0) {
+                out += ',';
+                whitespace(out);
+            }
+            string(out);
+            out.insert(out.size() - 1, "#" + std::to_string(i));
+            whitespace(out);
+            out += ':';
+            whitespace(out);
+            value(out, depth);
+        }
+        whitespace(out);
+        out += '}';
+    }
+};
+
+auto documents() -> const std::vector<std::string>& {
+    static const auto toReturn = [] {
+        std::vector<std::string> documents = {
+            "{}", "[]", "[[]]", "[{}]", " { } ", "\n[\n]\n",
+            R"({"a":1,"b":-2,"c":18446744073709551615,"d":1.5,"e":true,"f":false,"g":null})",
+            R"(["","123456789012345","1234567890123456","\u0000","\"\\\/\b\f\n\r\t"])",
+            R"({"nested":{"deeper":{"deepest":[1,[2,[3,[4]]]]}}})",
+            R"([0,-0,0.0,-0.0,1e0,1E+2,1e-2,9223372036854775807,-9223372036854775808,9223372036854775808])",
+            R"({"":"empty key","k":""})",
+            "[" + std::string(300, '1') + "]",
+            "[\"" + std::string(100000, 'x') + "\"]"
+        };
+        auto generator = Generator(42);
+        for (int i = 0; i < 300; ++i) {
+            std::string document;
+            if (i % 2 == 0) {
+                generator.object(document, i % 7);
+            } else {
+                generator.array(document, i % 7);
+            }
+            documents.push_back(std::move(document));
+        }
+        return documents;
+    }();
+    return toReturn;
+}
+
+/**
+ * Formats a number canonically.
+ *
+ * @param out the text to append to
+ * @param type the type of the number
+ * @param integer the value if the type is @c Int
+ * @param unsignedInteger the value if the type is @c UInt
+ * @param floating the value if the type is @c Double
+ */
+static inline void dumpNumber(std::string& out, ValueType type, long integer, unsigned long unsignedInteger, double floating) {
+    char buffer[32];
+    switch (type) {
+        case ValueType::Int:  std::snprintf(buffer, sizeof(buffer), "i%ld", integer);          break;
+        case ValueType::UInt: std::snprintf(buffer, sizeof(buffer), "u%lu", unsignedInteger);  break;
+        default:              std::snprintf(buffer, sizeof(buffer), "d%.17g", floating);       break;
+    }
+    out += buffer;
+}
+
+/**
+ * Formats a string canonically.
+ *
+ * @param out the text to append to
+ * @param string the string
+ */
+static inline void dumpString(std::string& out, std::string_view string) {
+    out += '"';
+    out += std::to_string(string.size());
+    out += ':';
+    out += string;
+    out += '"';
+}
+
+static void dump(std::string& out, const Value& value) {
+    switch (value.type) {
+        case ValueType::Int:    dumpNumber(out, value.type, value.as<ValueType::Int>(), 0, 0);    break;
+        case ValueType::UInt:   dumpNumber(out, value.type, 0, value.as<ValueType::UInt>(), 0);   break;
+        case ValueType::Double: dumpNumber(out, value.type, 0, 0, value.as<ValueType::Double>()); break;
+        case ValueType::String: dumpString(out, value.asStringView());                            break;
+        case ValueType::Bool:   out += value.as<ValueType::Bool>() ? "true" : "false";            break;
+        case ValueType::Null:   out += "null";                                                    break;
+
+        case ValueType::Array:
+            out += '[';
+            for (const auto& element : value.as<ValueType::Array>()) {
+                dump(out, element);
+                out += ',';
+            }
+            out += ']';
+            break;
+
+        case ValueType::Object:
+            out += '{';
+            for (const auto& [name, member] : value.as<ValueType::Object>()) {
+                dumpString(out, name);
+                out += ':';
+                dump(out, member);
+                out += ',';
+            }
+            out += '}';
+            break;
+    }
+}
+
+static void dump(std::string& out, ValueRef value) {
+    switch (value.getType()) {
+        case ValueType::Int:    dumpNumber(out, ValueType::Int, value.as<ValueType::Int>(), 0, 0);          break;
+        case ValueType::UInt:   dumpNumber(out, ValueType::UInt, 0, value.as<ValueType::UInt>(), 0);        break;
+        case ValueType::Double: dumpNumber(out, ValueType::Double, 0, 0, value.as<ValueType::Double>());    break;
+        case ValueType::String: dumpString(out, value.as<ValueType::String>());                             break;
+        case ValueType::Bool:   out += value.as<ValueType::Bool>() ? "true" : "false";                      break;
+        case ValueType::Null:   out += "null";                                                              break;
+
+        case ValueType::Array:
+            out += '[';
+            for (const auto element : value.as<ValueType::Array>()) {
+                dump(out, element);
+                out += ',';
+            }
+            out += ']';
+            break;
+
+        case ValueType::Object:
+            out += '{';
+            for (const auto [name, member] : value.as<ValueType::Object>()) {
+                dumpString(out, name);
+                out += ':';
+                dump(out, member);
+                out += ',';
+            }
+            out += '}';
+            break;
+    }
+}
+
+static void dump(std::string& out, const CompactValue& value) {
+    switch (value.getType()) {
+        case ValueType::Int:    dumpNumber(out, ValueType::Int, value.as<ValueType::Int>(), 0, 0);          break;
+        case ValueType::UInt:   dumpNumber(out, ValueType::UInt, 0, value.as<ValueType::UInt>(), 0);        break;
+        case ValueType::Double: dumpNumber(out, ValueType::Double, 0, 0, value.as<ValueType::Double>());    break;
+        case ValueType::String: dumpString(out, value.as<ValueType::String>());                             break;
+        case ValueType::Bool:   out += value.as<ValueType::Bool>() ? "true" : "false";                      break;
+        case ValueType::Null:   out += "null";                                                              break;
+
+        case ValueType::Array:
+            out += '[';
+            for (const auto& element : value.as<ValueType::Array>()) {
+                dump(out, element);
+                out += ',';
+            }
+            out += ']';
+            break;
+
+        case ValueType::Object:
+            out += '{';
+            for (const auto [name, member] : value.as<ValueType::Object>()) {
+                dumpString(out, name);
+                out += ':';
+                dump(out, member);
+                out += ',';
+            }
+            out += '}';
+            break;
+    }
+}
+
+static void dump(std::string& out, const LazyValue& value, const Value& reference) {
+    switch (value.getType()) {
+        case ValueType::Int:    dumpNumber(out, ValueType::Int, value.as<ValueType::Int>(), 0, 0);          break;
+        case ValueType::UInt:   dumpNumber(out, ValueType::UInt, 0, value.as<ValueType::UInt>(), 0);        break;
+        case ValueType::Double: dumpNumber(out, ValueType::Double, 0, 0, value.as<ValueType::Double>());    break;
+        case ValueType::String: dumpString(out, value.as<ValueType::String>());                             break;
+        case ValueType::Bool:   out += value.as<ValueType::Bool>() ? "true" : "false";                      break;
+        case ValueType::Null:   out += "null";                                                              break;
+
+        case ValueType::Array: {
+            out += '[';
+            const auto& elements = reference.as<ValueType::Array>();
+            std::size_t i = 0;
+            for (const auto& element : value.as<ValueType::Array>()) {
+                dump(out, element, elements.at(i++));
+                out += ',';
+            }
+            out += ']';
+            break;
+        }
+
+        case ValueType::Object: {
+            out += '{';
+            const auto object = value.as<ValueType::Object>();
+            for (const auto& [name, member] : reference.as<ValueType::Object>()) {
+                if (const auto found = object.find(name)) {
+                    dumpString(out, name);
+                    out += ':';
+                    dump(out, *found, member);
+                    out += ',';
+                }
+            }
+            out += '}';
+            break;
+        }
+    }
+}
+
+auto dump(const Value& value) -> std::string {
+    std::string toReturn;
+    dump(toReturn, value);
+    return toReturn;
+}
+
+auto dump(ValueRef value) -> std::string {
+    std::string toReturn;
+    dump(toReturn, value);
+    return toReturn;
+}
+
+auto dump(const CompactValue& value) -> std::string {
+    std::string toReturn;
+    dump(toReturn, value);
+    return toReturn;
+}
+
+auto dump(const LazyValue& value, const Value& reference) -> std::string {
+    std::string toReturn;
+    dump(toReturn, value, reference);
+    return toReturn;
+}
+}
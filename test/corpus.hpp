@@ -0,0 +1,69 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_test_corpus_hpp
+#define SimpleJSON_test_corpus_hpp
+
+#include <string>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+namespace simple_json::test {
+/**
+ * Returns JSON documents covering the grammar: handwritten edge cases and
+ * randomly generated documents from a fixed seed. The keys of the objects
+ * are unique.
+ *
+ * @return the documents, each with an array or object at the root
+ */
+auto documents() -> const std::vector<std::string>&;
+
+/**
+ * Formats the given value canonically, including the types of the numbers.
+ *
+ * @param value the value
+ * @return the canonical text
+ */
+auto dump(const Value& value) -> std::string;
+
+/**
+ * Formats the given tape value canonically.
+ *
+ * @param value the value
+ * @return the canonical text
+ */
+auto dump(ValueRef value) -> std::string;
+
+/**
+ * Formats the given compact value canonically.
+ *
+ * @param value the value
+ * @return the canonical text
+ */
+auto dump(const CompactValue& value) -> std::string;
+
+/**
+ * Formats the given lazy value canonically. Since lazy objects cannot be
+ * iterated, their members are looked up by the keys of the given reference.
+ *
+ * @param value the value
+ * @param reference the same value parsed by @c parse
+ * @return the canonical text
+ */
+auto dump(const LazyValue& value, const Value& reference) -> std::string;
+}
+
+#endif /* SimpleJSON_test_corpus_hpp */
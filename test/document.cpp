@@ -0,0 +1,120 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * Returns whether the given string lies inside of the given buffer.
+ *
+ * @param string the string
+ * @param buffer the buffer
+ * @return whether the string is a view into the buffer
+ */
+static inline auto isInside(std::string_view string, std::string_view buffer) -> bool {
+    return string.data() >= buffer.data() && string.data() + string.size() <= buffer.data() + buffer.size();
+}
+
+SIMPLE_JSON_TEST(documentBorrowsStrings) {
+    const auto buffer   = std::string(R"({"plain": "in the buffer", "escaped": "with \"escapes\"", "array": ["a", "b\n"]})");
+    const auto document = Document(std::string_view(buffer));
+    CHECK(document.getData().data() == buffer.data());
+
+    const auto object = ObjectView(document.getRoot());
+    CHECK(object.getStringViewBang("plain") == "in the buffer");
+    CHECK(isInside(object.getStringViewBang("plain"), buffer));
+    CHECK(object.getStringView("escaped") == "with \"escapes\"");
+    CHECK(!isInside(*object.getStringView("escaped"), buffer));
+    CHECK(!object.getStringView("missing").has_value());
+    CHECK_THROWS(object.getStringViewBang("array"), std::bad_variant_access);
+
+    const auto& array = object.getBang<ValueType::Array>("array");
+    CHECK(array.at(0).asStringView() == "a" && isInside(array.at(0).asStringView(), buffer));
+    CHECK(array.at(1).asStringView() == "b\n");
+    CHECK(array.at(0).is(ValueType::String));
+}
+
+SIMPLE_JSON_TEST(documentOwnsItsBuffer) {
+    auto data = std::string(R"(["a string long enough not to fit into the small-string buffer", "\t"])");
+    auto document = Document(std::move(data));
+    data.assign(100, ' ');
+    const auto moved = std::move(document);
+    const auto& array = moved.getRoot().as<ValueType::Array>();
+    CHECK(array.at(0).asStringView() == "a string long enough not to fit into the small-string buffer");
+    CHECK(isInside(array.at(0).asStringView(), moved.getData()));
+    CHECK(array.at(1).asStringView() == "\t");
+
+    auto stream = std::istringstream(R"(  {"key": "value"} )");
+    const auto streamed = Document(stream);
+    CHECK(Object(streamed.getRoot()).getStringViewBang("key") == "value");
+    CHECK(dump(streamed.getRoot()) == dump(parse(R"({"key": "value"})")));
+}
+
+SIMPLE_JSON_TEST(documentMoveAssignment) {
+    const auto first  = std::string(R"({"a":[1,2,{"b":"escaped \n string"}],"c":"borrowed string"})");
+    const auto second = std::string(R"([{"d":"another \t escaped string"},[3,4]])");
+
+    auto a = Document(std::string(first));
+    auto b = Document(std::string(second));
+    a = std::move(b);
+    CHECK(dump(a.getRoot()) == dump(parse(second)));
+
+    auto c = Document(std::string_view(first));
+    c = Document(std::string_view(second));
+    CHECK(dump(c.getRoot()) == dump(parse(second)));
+
+    auto d = Document(std::move(c));
+    CHECK(dump(d.getRoot()) == dump(parse(second)));
+    d = std::move(d);
+    CHECK(dump(d.getRoot()) == dump(parse(second)));
+}
+
+SIMPLE_JSON_TEST(documentCopiesOwnTheirStrings) {
+    Value copy;
+    Object object;
+    {
+        auto buffer = std::string(R"({"borrowed":"from the buffer","escaped":"decoded \"into\" the arena",)"
+                                  R"("nested":{"array":["in","an","array"]}})");
+        const auto document = Document(std::string_view(buffer));
+        copy   = document.getRoot();
+        object = document.getRoot();
+
+        const auto root = ObjectView(document.getRoot());
+        CHECK(root.getObjectBang("nested").getBang<ValueType::Array>("array").at(0).asStringView() == "in");
+        CHECK(root.getStringViewBang("borrowed") == "from the buffer");
+        CHECK(root.get<ValueType::String>("escaped") == std::string("decoded \"into\" the arena"));
+        CHECK_THROWS(root.getBang<ValueType::String>("borrowed"), std::bad_variant_access);
+        CHECK(root.tryGet<ValueType::String>("borrowed") == nullptr);
+        CHECK(Value(root.getContent().at("borrowed")).as<ValueType::String>() == "from the buffer");
+        buffer.assign(buffer.size(), ' ');
+    }
+    const auto copied = ObjectView(copy);
+    CHECK(copied.getBang<ValueType::String>("borrowed") == "from the buffer");
+    CHECK(copied.getBang<ValueType::String>("escaped") == "decoded \"into\" the arena");
+    CHECK(copied.getObjectBang("nested").getBang<ValueType::Array>("array")[2].as<ValueType::String>() == "array");
+    CHECK(object.getBang<ValueType::String>("borrowed") == "from the buffer");
+    CHECK(object.getStringViewBang("escaped") == "decoded \"into\" the arena");
+}
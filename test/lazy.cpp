@@ -0,0 +1,68 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "allocations.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(lazyLooksUpMembers) {
+    const std::string_view data = R"({"skipped": {"text": "with } and ] and \" inside", "list": [[], {}, "]"]},
+                                      "first": 1, "second": {"inner": [10, 20, 30]}, "third": "three", "none": null})";
+    const auto object = parseLazy(data).as<ValueType::Object>();
+    // In document order, out of order and repeated.
+    CHECK(object.getBang<ValueType::Int>("first") == 1);
+    CHECK(object.getObjectBang("second").getBang<ValueType::Array>("inner")[2].as<ValueType::Int>() == 30);
+    CHECK(object.getBang<ValueType::String>("third") == "three");
+    CHECK(object.getBang<ValueType::Int>("first") == 1);
+    CHECK(object.getObjectBang("skipped").getBang<ValueType::String>("text") == "with } and ] and \" inside");
+    CHECK(object.getObjectBang("skipped").getBang<ValueType::Array>("list").size() == 3);
+
+    CHECK(!object.find("missing").has_value());
+    CHECK(!object.get<ValueType::Int>("none").has_value());
+    CHECK(!object.getObject("none").has_value());
+    CHECK_THROWS(object.getBang<ValueType::Int>("missing"), std::out_of_range);
+    CHECK_THROWS(object.getBang<ValueType::Int>("third"), std::bad_variant_access);
+}
+
+SIMPLE_JSON_TEST(lazyLookupsDoNotAllocate) {
+    std::string data = "{";
+    for (int i = 0; i < 100; ++i) {
+        data += "\"member" + std::to_string(i) + "\": {\"values\": [" + std::to_string(i) + ", \"a string to be skipped\"]}, ";
+    }
+    data += "\"last\": 100}";
+
+    const auto counter = AllocationCounter();
+    const auto object  = parseLazy(data).as<ValueType::Object>();
+    CHECK(object.getBang<ValueType::Int>("last") == 100);
+    CHECK(object.getObjectBang("member42").getBang<ValueType::Array>("values")[0].as<ValueType::Int>() == 42);
+    CHECK(object.getObjectBang("member7").getBang<ValueType::Array>("values").size() == 2);
+    CHECK(counter.getCount() == 0);
+}
+
+SIMPLE_JSON_TEST(lazyRejectsMalformedData) {
+    CHECK_THROWS(parseLazy("12"), Exception);
+    CHECK_THROWS(parseLazy(""), Exception);
+    CHECK_THROWS(parseLazy(R"({"a": "unterminated)").as<ValueType::Object>().find("b"), Exception);
+    CHECK_THROWS(parseLazy(R"({"a": [1, 2, "b": 1})").as<ValueType::Object>().find("b"), Exception);
+}
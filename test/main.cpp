@@ -0,0 +1,59 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+
+#include "test.hpp"
+
+namespace simple_json::test {
+auto cases() -> std::vector<Case>& {
+    static std::vector<Case> toReturn;
+    return toReturn;
+}
+
+void fail(const char* check, const char* file, int line) {
+    throw Failure { std::string(file) + ":" + std::to_string(line) + ": " + check };
+}
+}
+
+int main(int argc, char** argv) {
+    using namespace simple_json::test;
+
+    std::size_t run = 0, failed = 0;
+    for (const auto& testCase : cases()) {
+        auto selected = argc < 2;
+        for (int i = 1; i < argc && !selected; ++i) {
+            selected = std::strstr(testCase.name, argv[i]) != nullptr;
+        }
+        if (!selected) {
+            continue;
+        }
+        ++run;
+        try {
+            testCase.function();
+            continue;
+        } catch (const Failure& failure) {
+            std::printf("FAIL %s: %s\n", testCase.name, failure.message.c_str());
+        } catch (const std::exception& exception) {
+            std::printf("FAIL %s: unexpected exception: %s\n", testCase.name, exception.what());
+        }
+        ++failed;
+    }
+    std::printf("%zu of %zu tests passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <unistd.h>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * A temporary file removed when destroyed.
+ */
+class TemporaryFile {
+    /** The path of the file. */
+    std::string path = "/tmp/simple_json_XXXXXX";
+
+public:
+    /**
+     * Creates a temporary file with the given content.
+     *
+     * @param content the content of the file
+     */
+    explicit TemporaryFile(std::string_view content) {
+        const auto descriptor = mkstemp(path.data());
+        if (descriptor < 0) {
+            std::abort();
+        }
+        close(descriptor);
+        std::ofstream(path, std::ios::binary).write(content.data(), std::streamsize(content.size()));
+    }
+
+    ~TemporaryFile() {
+        std::remove(path.c_str());
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+
+    /**
+     * Returns the path of the file.
+     *
+     * @return the path
+     */
+    inline auto getPath() const -> const std::string& {
+        return path;
+    }
+};
+
+SIMPLE_JSON_TEST(parseFileMatchesParse) {
+    for (const auto& document : documents()) {
+        const auto file = TemporaryFile(document);
+        CHECK(dump(parseFile(file.getPath()).getRoot()) == dump(parse(document)));
+    }
+
+    // Content ending exactly at a page boundary.
+    auto data = std::string(R"(["a string", )");
+    data.resize(4096 - 2, ' ');
+    data += "1]";
+    const auto file = TemporaryFile(data);
+    CHECK(dump(parseFile(file.getPath()).getRoot()) == dump(parse(data)));
+}
+
+SIMPLE_JSON_TEST(parseFileRefersToTheFile) {
+    const auto file   = TemporaryFile(R"({"key": "in the file"})");
+    auto mapped       = MappedFile(file.getPath());
+    const auto data   = mapped.getData();
+    CHECK(data == R"({"key": "in the file"})");
+
+    const auto document = Document(std::move(mapped));
+    CHECK(document.getData().data() == data.data());
+    const auto value = ObjectView(document.getRoot()).getStringViewBang("key");
+    CHECK(value == "in the file");
+    CHECK(value.data() > data.data() && value.data() + value.size() < data.data() + data.size());
+}
+
+SIMPLE_JSON_TEST(mappedFileMoves) {
+    const auto first  = TemporaryFile("[1]");
+    const auto second = TemporaryFile(R"({"a": "b"})");
+    auto a = MappedFile(first.getPath());
+    auto b = MappedFile(second.getPath());
+    const auto data = a.getData().data();
+
+    // Short contents keep their address, too.
+    auto moved = MappedFile(std::move(a));
+    CHECK(moved.getData().data() == data && moved.getData() == "[1]");
+    CHECK(a.getData().empty());
+    moved = std::move(b);
+    CHECK(moved.getData() == R"({"a": "b"})");
+    CHECK(b.getData().data() == data && b.getData() == "[1]");
+    b = MappedFile();
+    CHECK(b.getData().empty() && moved.getData() == R"({"a": "b"})");
+}
+
+SIMPLE_JSON_TEST(parseFileEmpty) {
+    const auto file = TemporaryFile("");
+    CHECK(MappedFile(file.getPath()).getData().empty());
+    CHECK_THROWS(parseFile(file.getPath()), Exception);
+}
+
+SIMPLE_JSON_TEST(parseFileMissing) {
+    CHECK_THROWS(MappedFile("/nonexistent/simple_json.json"), std::system_error);
+    CHECK_THROWS(parseFile("/nonexistent/simple_json.json"), std::system_error);
+}
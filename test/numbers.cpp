@@ -0,0 +1,139 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+#include <SimpleJSON/numbers.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+
+/**
+ * Converts the given complete number using the number kernel.
+ *
+ * @param text the number
+ * @param number set to the converted number
+ * @return whether the whole text was converted
+ */
+static inline auto convert(const std::string& text, numbers::Number& number) -> bool {
+    const auto end = text.data() + text.size();
+    return numbers::parse(text.data(), end, number) == end;
+}
+
+/**
+ * Returns whether the given number is converted to the same double as by
+ * @c strtod , bit for bit.
+ *
+ * @param text the number
+ * @return whether the conversions match
+ */
+static auto matchesStrtod(const std::string& text) -> bool {
+    numbers::Number number;
+    if (!convert(text, number) || number.type != ValueType::Double) {
+        return false;
+    }
+    const auto expected = std::strtod(text.c_str(), nullptr);
+    return std::memcmp(&number.floating, &expected, sizeof(double)) == 0;
+}
+
+SIMPLE_JSON_TEST(numbersRoundHalfwayCasesToEven) {
+    // Exactly between two doubles: 2^53 + 1, 2^53 + 3 and their scaled variants.
+    for (const auto* text : { "9007199254740993.0", "9007199254740995.0", "9007199254740993e10",
+                              "1.00000000000000011102230246251565404236316680908203125",
+                              "1.00000000000000033306690738754696212708950042724609375",
+                              "1.0000000000000001110223024625156540423631668090820312500001",
+                              "2.2250738585072011e-308", "4.9406564584124654e-324" }) {
+        CHECK(matchesStrtod(text));
+    }
+    numbers::Number number;
+    CHECK(convert("9007199254740993.0", number) && number.floating == 9007199254740992.0);
+    CHECK(convert("9007199254740995.0", number) && number.floating == 9007199254740996.0);
+}
+
+SIMPLE_JSON_TEST(numbersConvertSubnormals) {
+    for (const auto* text : { "4.9406564584124654e-324", "5e-324", "2.4703282292062328e-324", "2.4703282292062327e-324",
+                              "1e-320", "2.225073858507201e-308", "2.2250738585072014e-308", "1e-400", "123e-330" }) {
+        CHECK(matchesStrtod(text));
+    }
+    numbers::Number number;
+    CHECK(convert("2.4703282292062327e-324", number) && number.floating == 0.0);
+    CHECK(convert("2.4703282292062328e-324", number) && number.floating > 0.0);
+    CHECK(convert("1.7976931348623157e308", number) && number.floating == 1.7976931348623157e308);
+    CHECK(!convert("1.7976931348623159e308", number));
+    CHECK(!convert("1e400", number));
+}
+
+SIMPLE_JSON_TEST(numbersKeepNegativeZero) {
+    numbers::Number number;
+    for (const auto* text : { "-0.0", "-0e5", "-0.000e-3", "-1e-400" }) {
+        CHECK(convert(text, number) && number.type == ValueType::Double);
+        CHECK(number.floating == 0.0 && std::signbit(number.floating));
+    }
+    CHECK(convert("-0", number) && number.type == ValueType::Int && number.integer == 0);
+    CHECK(convert("0.0", number) && !std::signbit(number.floating));
+}
+
+SIMPLE_JSON_TEST(numbersChooseTheIntegerType) {
+    numbers::Number number;
+    CHECK(convert("9223372036854775806", number) && number.type == ValueType::Int && number.integer == LONG_MAX - 1);
+    CHECK(convert("9223372036854775807", number) && number.type == ValueType::Int && number.integer == LONG_MAX);
+    CHECK(convert("-9223372036854775807", number) && number.type == ValueType::Int && number.integer == -LONG_MAX);
+    CHECK(convert("-9223372036854775808", number) && number.type == ValueType::Int && number.integer == LONG_MIN);
+    CHECK(convert("9223372036854775808", number) && number.type == ValueType::UInt
+          && number.unsignedInteger == static_cast<unsigned long>(LONG_MAX) + 1);
+    CHECK(convert("-9223372036854775809", number) && number.type == ValueType::Double
+          && number.floating == -9223372036854775808.0);
+    CHECK(convert("18446744073709551614", number) && number.type == ValueType::UInt
+          && number.unsignedInteger == ULONG_MAX - 1);
+    CHECK(convert("18446744073709551615", number) && number.type == ValueType::UInt
+          && number.unsignedInteger == ULONG_MAX);
+    CHECK(convert("18446744073709551616", number) && number.type == ValueType::Double
+          && number.floating == 18446744073709551616.0);
+    CHECK(convert("99999999999999999999", number) && number.type == ValueType::Double && matchesStrtod("99999999999999999999"));
+}
+
+SIMPLE_JSON_TEST(numbersConvertLongMantissas) {
+    // More than 19 significant digits: decided by rounding the truncated mantissa or by the fallback.
+    std::string digits = "0.";
+    for (int i = 0; i < 800; ++i) {
+        digits += static_cast<char>('0' + i % 10);
+    }
+    for (const auto& text : { std::string("3.14159265358979323846264338327950288"),
+                              std::string("1.00000000000000011102230246251565404236316680908203125000000001"),
+                              std::string("123456789012345678901234567890e-20"),
+                              std::string("7.4109846876186981626485318930233205854758970392148714663837852375101326090531312779794975"
+                                          "38588e-323"),
+                              digits, "-" + digits + "e300" }) {
+        CHECK(matchesStrtod(text));
+    }
+}
+
+SIMPLE_JSON_TEST(numbersRejectMalformedNumbers) {
+    numbers::Number number;
+    for (const auto* text : { "01", "-01", "0000", "00.5", "1.", "1.e5", "1e", "1e+", "-e5", "-", ".5", "+1", "1E-" }) {
+        CHECK(!convert(text, number));
+        CHECK_THROWS(parse(std::string("[") + text + "]"), Exception);
+    }
+    for (const auto* text : { "0", "-0", "0.5", "0e0", "1E+2", "1e-2", "10" }) {
+        CHECK(convert(text, number));
+        CHECK(parse(std::string("[") + text + "]").as<ValueType::Array>().size() == 1);
+    }
+}
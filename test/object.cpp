@@ -0,0 +1,140 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+
+/**
+ * Returns the keys of the given object in iteration order.
+ *
+ * @param object the object
+ * @return the keys
+ */
+static auto keys(const ObjectContent& object) -> std::vector<std::string> {
+    std::vector<std::string> toReturn;
+    for (const auto& [key, value] : object) {
+        toReturn.push_back(key);
+    }
+    return toReturn;
+}
+
+/**
+ * Returns the integer mapped to the given key.
+ *
+ * @param object the object
+ * @param key the key
+ * @return the mapped integer
+ */
+static inline auto integer(const ObjectContent& object, std::string_view key) -> long {
+    return object.at(key).as<ValueType::Int>();
+}
+
+SIMPLE_JSON_TEST(objectKeepsInsertionOrder) {
+    ObjectContent object;
+    for (const auto* key : { "z", "a", "m", "b" }) {
+        object.emplace(key, Value { ValueType::Int, 1L });
+    }
+    CHECK((keys(object) == std::vector<std::string> { "z", "a", "m", "b" }));
+    CHECK(!object.emplace("a", Value { ValueType::Int, 2L }).second);
+    CHECK(integer(object, "a") == 1);
+    CHECK(!object.insert_or_assign("a", Value { ValueType::Int, 3L }).second);
+    CHECK(integer(object, "a") == 3);
+    CHECK(object.count("m") == 1 && object.count("x") == 0);
+    CHECK_THROWS(object.at("x"), std::out_of_range);
+}
+
+SIMPLE_JSON_TEST(objectIndexRebuiltAfterErase) {
+    ObjectContent object;
+    for (long i = 0; i < 40; ++i) {
+        object.emplace("key" + std::to_string(i), Value { ValueType::Int, i });
+    }
+    // Erasing shifts the members, the index needs to follow them, also when dropping below the threshold.
+    for (long i = 0; i < 40; i += 3) {
+        CHECK(object.erase("key" + std::to_string(i)) == 1);
+        CHECK(object.erase("key" + std::to_string(i)) == 0);
+        for (long j = 0; j < 40; ++j) {
+            const auto key = "key" + std::to_string(j);
+            CHECK(object.contains(key) == (j > i || j % 3 != 0));
+            if (object.contains(key)) {
+                CHECK(integer(object, key) == j);
+            }
+        }
+    }
+    for (auto it = object.begin(); it != object.end();) {
+        it = object.size() > 5 ? object.erase(it) : it + 1;
+    }
+    CHECK(object.size() == 5);
+    CHECK((keys(object) == std::vector<std::string> { "key32", "key34", "key35", "key37", "key38" }));
+    for (const auto& [key, value] : object) {
+        CHECK(object.find(key)->second.as<ValueType::Int>() == value.as<ValueType::Int>());
+    }
+    object["new"] = Value { ValueType::Int, 100L };
+    CHECK(integer(object, "new") == 100 && object.size() == 6);
+}
+
+SIMPLE_JSON_TEST(objectDuplicateKeysCrossingThreshold) {
+    // The duplicates appear before and after the index is built; the last value wins at the first position.
+    std::string data = "{";
+    for (int i = 0; i < 12; ++i) {
+        data += "\"k" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+        if (i == 4 || i == 10) {
+            data += "\"k0\": " + std::to_string(100 + i) + ", \"k3\": " + std::to_string(300 + i) + ", ";
+        }
+    }
+    data += "\"k11\": 1111}";
+    const auto value  = parse(data);
+    const auto object = value.as<ValueType::Object>();
+    CHECK(object.size() == 12);
+    CHECK(integer(object, "k0") == 110);
+    CHECK(integer(object, "k3") == 310);
+    CHECK(integer(object, "k11") == 1111);
+    CHECK(keys(object).front() == "k0" && keys(object)[3] == "k3" && keys(object).back() == "k11");
+    for (int i = 1; i < 11; ++i) {
+        if (i != 3) CHECK(integer(object, "k" + std::to_string(i)) == i);
+    }
+}
+
+SIMPLE_JSON_TEST(objectOrderAfterMixedInsertAndErase) {
+    ObjectContent object;
+    std::vector<std::string> expected, erased;
+    for (long i = 0; i < 30; ++i) {
+        const auto key = "m" + std::to_string(i);
+        object.insert_or_assign(key, Value { ValueType::Int, i });
+        expected.push_back(key);
+        if (i % 4 == 3) {
+            erased.push_back(expected[expected.size() / 2]);
+            object.erase(erased.back());
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(expected.size() / 2));
+        }
+        if (i % 5 == 0) {
+            // Re-assigning an existing key keeps its position.
+            object.insert_or_assign(expected.front(), Value { ValueType::Int, -i });
+        }
+        CHECK(keys(object) == expected);
+    }
+    for (const auto& key : expected) {
+        CHECK(object.find(key) != object.end() && object.find(key)->first == key);
+    }
+    for (const auto& key : erased) {
+        CHECK(object.find(key) == object.end());
+    }
+}
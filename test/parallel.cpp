@@ -0,0 +1,195 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * Returns the documents of the corpus without line breaks.
+ *
+ * @return the single line documents
+ */
+static auto singleLines() -> const std::vector<std::string>& {
+    static const auto toReturn = [] {
+        std::vector<std::string> lines;
+        for (auto document : documents()) {
+            // The strings of the corpus contain no raw line breaks.
+            for (auto& c : document) {
+                if (c == '\n' || c == '\r') c = ' ';
+            }
+            lines.push_back(std::move(document));
+        }
+        return lines;
+    }();
+    return toReturn;
+}
+
+/**
+ * Returns the single line documents of the corpus, one per line.
+ *
+ * @return the concatenated documents
+ */
+static auto lines() -> std::string {
+    std::string toReturn;
+    for (const auto& document : singleLines()) {
+        toReturn += document;
+        toReturn += '\n';
+    }
+    return toReturn;
+}
+
+SIMPLE_JSON_TEST(parallelMatchesParse) {
+    const auto data = lines();
+    auto pool = ThreadPool(4);
+    auto options = ParallelOptions();
+    options.chunkSize = 1024;
+
+    std::vector<std::string> values;
+    parseParallel(data, [&values](Value& value) { values.push_back(dump(value)); }, pool, options);
+    CHECK(values.size() == singleLines().size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        CHECK(values[i] == dump(parse(singleLines()[i])));
+    }
+
+    options.ordered = false;
+    std::atomic<std::size_t> count { 0 };
+    parseParallel(data, [&count](Value&) { ++count; }, pool, options);
+    CHECK(count == singleLines().size());
+
+    auto stream = std::istringstream(data);
+    options.ordered = true;
+    options.threads = 2;
+    values.clear();
+    parseParallel(stream, [&values](Value& value) { values.push_back(dump(value)); }, options);
+    CHECK(values.size() == singleLines().size() && values.back() == dump(parse(singleLines().back())));
+}
+
+SIMPLE_JSON_TEST(parallelRethrowsParseErrors) {
+    auto data = lines();
+    data += "[1, 2\n";
+    data += lines();
+    auto pool = ThreadPool(4);
+    auto options = ParallelOptions();
+    options.chunkSize = 1024;
+    for (const auto ordered : { true, false }) {
+        options.ordered = ordered;
+        CHECK_THROWS(parseParallel(data, [](Value&) {}, pool, options), Exception);
+    }
+    // The pool is still usable.
+    options.ordered = true;
+    std::size_t count = 0;
+    parseParallel(lines(), [&count](Value&) { ++count; }, pool, options);
+    CHECK(count == singleLines().size());
+}
+
+SIMPLE_JSON_TEST(parallelRethrowsConsumerErrors) {
+    const auto data = lines();
+    auto pool = ThreadPool(4);
+    auto options = ParallelOptions();
+    options.chunkSize = 1024;
+
+    std::size_t count = 0;
+    const auto throwing = [&count](Value&) {
+        if (++count == 10) {
+            throw std::runtime_error("consumer");
+        }
+    };
+    CHECK_THROWS(parseParallel(data, throwing, pool, options), std::runtime_error);
+    // The ordered consumer is not called after it has thrown.
+    CHECK(count == 10);
+
+    options.ordered = false;
+    CHECK_THROWS(parseParallel(data, [](Value&) { throw std::runtime_error("consumer"); }, pool, options),
+                 std::runtime_error);
+}
+
+SIMPLE_JSON_TEST(parallelPoolRunsAllTasks) {
+    std::atomic<std::size_t> count = 0;
+    {
+        auto pool = ThreadPool(4);
+        for (std::size_t round = 1; round <= 50; ++round) {
+            // The threads fall asleep between the rounds and have to be woken again.
+            for (std::size_t i = 0; i < 20; ++i) {
+                pool.submit([&pool, &count] {
+                    pool.submit([&count] { ++count; });
+                    ++count;
+                });
+            }
+            while (count < round * 40) {
+                std::this_thread::yield();
+            }
+        }
+        pool.submit([&pool, &count] {
+            for (std::size_t i = 0; i < 100; ++i) {
+                pool.submit([&count] { ++count; });
+            }
+        });
+    }
+    // The destructor executes the remaining tasks.
+    CHECK(count == 50 * 40 + 100);
+}
+
+SIMPLE_JSON_TEST(parallelArrayMatchesParse) {
+    std::string data = "[";
+    for (const auto& document : singleLines()) {
+        data += document;
+        data += ',';
+    }
+    data += "null]";
+    auto options = ParallelOptions();
+    options.threads   = 4;
+    options.chunkSize = 1024;
+    const auto elements = parseArrayParallel(data, options);
+    CHECK(dump(Value { ValueType::Array, elements }) == dump(parse(data)));
+
+    // The parsed array is shared by its copies.
+    const auto copy = elements;
+    CHECK(elements.isShared() && copy.isShared());
+    CHECK(&elements[0] == &copy[0]);
+
+    const auto nested = R"({"skipped": [1, 2], "a": {"b": )" + data + "}, \"c\": 3}";
+    CHECK(dump(Value { ValueType::Array, parseArrayParallel(nested, { "a", "b" }, options) }) == dump(parse(data)));
+    CHECK(parseArrayParallel("[]", options).empty());
+}
+
+SIMPLE_JSON_TEST(parallelArrayRethrowsParseErrors) {
+    std::string data = "[";
+    for (std::size_t i = 0; i < 1000; ++i) {
+        data += i == 500 ? "{\"a\" 1}, " : "[1, {\"a\": \"b\"}], ";
+    }
+    data += "null]";
+    auto options = ParallelOptions();
+    options.threads   = 4;
+    options.chunkSize = 256;
+    CHECK_THROWS(parseArrayParallel(data, options), Exception);
+    CHECK_THROWS(parseArrayParallel("[1, 2", options), Exception);
+    CHECK_THROWS(parseArrayParallel("[1 2]", options), Exception);
+    CHECK_THROWS(parseArrayParallel("{\"a\": [1]}", { "b" }, options), std::out_of_range);
+    CHECK_THROWS(parseArrayParallel("{\"a\": 1}", { "a" }, options), std::bad_variant_access);
+    CHECK(parseArrayParallel("[1, 2, 3]", options).size() == 3);
+}
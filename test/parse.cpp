@@ -0,0 +1,212 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(parseStreamMatchesBuffer) {
+    for (const auto& document : documents()) {
+        auto stream = std::istringstream(document);
+        CHECK(dump(parse(stream)) == dump(parse(document)));
+    }
+}
+
+SIMPLE_JSON_TEST(parsePointerMatchesBuffer) {
+    for (const auto& document : documents()) {
+        CHECK(dump(parse(document.data(), document.size())) == dump(parse(std::string_view(document))));
+    }
+    const std::string_view data = "[1, 2] trailing";
+    CHECK(parse<ValueType::Array>(data.data(), 6).size() == 2);
+}
+
+SIMPLE_JSON_TEST(parseStreamKeepsFollowingData) {
+    auto stream = std::istringstream(R"([1] {"a": [2]} [3]  rest)");
+    CHECK(dump(parse(stream)) == dump(parse("[1]")));
+    CHECK(dump(parseCompact(stream)) == dump(parse(R"({"a": [2]})")));
+    const auto result = tryParse(stream);
+    CHECK(result.hasValue() && dump(*result) == dump(parse("[3]")));
+
+    std::string rest;
+    stream >> rest;
+    CHECK(rest == "rest");
+
+    auto malformed = std::istringstream("[1} [2]");
+    CHECK(!tryParse(malformed).hasValue() && malformed.fail() && !malformed.eof());
+    malformed.clear();
+    CHECK(dump(parse(malformed)) == dump(parse("[2]")));
+}
+
+/**
+ * A stream buffer that cannot be positioned, handing out the data in chunks
+ * of the given size like a pipe. Without a chunk size it has no buffer.
+ */
+class PipeBuffer: public std::streambuf {
+    /** The data to hand out.                */
+    std::string data;
+    /** The size of the chunks.              */
+    std::size_t chunkSize;
+    /** The position of the next chunk.      */
+    std::size_t position = 0;
+
+protected:
+    auto underflow() -> int_type override {
+        if (position == data.size()) {
+            return traits_type::eof();
+        }
+        if (chunkSize == 0) {
+            return traits_type::to_int_type(data[position]);
+        }
+        const auto begin = data.data() + position;
+        position = std::min(data.size(), position + chunkSize);
+        setg(begin, begin, data.data() + position);
+        return traits_type::to_int_type(*begin);
+    }
+
+    auto uflow() -> int_type override {
+        if (chunkSize != 0) {
+            return std::streambuf::uflow();
+        }
+        return position == data.size() ? traits_type::eof() : traits_type::to_int_type(data[position++]);
+    }
+
+public:
+    inline PipeBuffer(std::string data, std::size_t chunkSize): data(std::move(data)), chunkSize(chunkSize) {}
+};
+
+SIMPLE_JSON_TEST(parsePipeKeepsFollowingData) {
+    for (const std::size_t chunkSize : { 0, 1, 3, 4096 }) {
+        auto buffer = PipeBuffer(R"( [1] {"a": [2]} ["3"][4]{} {"b"} rest)", chunkSize);
+        auto stream = std::istream(&buffer);
+        CHECK(stream.tellg() < 0);
+        CHECK(dump(parse(stream)) == dump(parse("[1]")));
+        CHECK(dump(parseCompact(stream)) == dump(parse(R"({"a": [2]})")));
+        const auto result = tryParse(stream);
+        CHECK(result.hasValue() && dump(*result) == dump(parse(R"(["3"])")));
+        CHECK(parse<ValueType::Array>(stream).size() == 1);
+
+        auto handler = NullHandler();
+        parse(stream, handler);
+        CHECK(stream.good() && stream.peek() == ' ');
+
+        CHECK_THROWS(parse(stream), Exception);
+        std::string rest;
+        stream.clear();
+        stream >> rest;
+        CHECK(rest == "rest");
+        CHECK_THROWS(parse(stream), Exception);
+        CHECK(stream.eof());
+
+        auto malformed = PipeBuffer("[1} [2]", chunkSize);
+        auto malformedStream = std::istream(&malformed);
+        CHECK(!tryParse(malformedStream).hasValue() && malformedStream.fail());
+        malformedStream.clear();
+        CHECK(dump(parse(malformedStream)) == dump(parse("[2]")));
+
+        for (const auto& document : documents()) {
+            auto pipe = PipeBuffer(document + " [0]", chunkSize);
+            auto piped = std::istream(&pipe);
+            CHECK(dump(parse(piped)) == dump(parse(document)));
+            CHECK(dump(parse(piped)) == dump(parse("[0]")));
+        }
+    }
+}
+
+SIMPLE_JSON_TEST(documentMatchesParse) {
+    for (const auto& document : documents()) {
+        const auto expected = dump(parse(document));
+        CHECK(dump(Document(std::string_view(document)).getRoot()) == expected);
+        CHECK(dump(Document(std::string(document)).getRoot()) == expected);
+        auto stream = std::istringstream(document);
+        CHECK(dump(Document(stream).getRoot()) == expected);
+    }
+}
+
+SIMPLE_JSON_TEST(tapeMatchesParse) {
+    for (const auto& document : documents()) {
+        const auto tape = Tape(document);
+        CHECK(dump(tape.getRoot()) == dump(parse(document)));
+        auto stream = std::istringstream(document);
+        CHECK(dump(Tape(stream).getRoot()) == dump(parse(document)));
+    }
+}
+
+SIMPLE_JSON_TEST(lazyMatchesParse) {
+    for (const auto& document : documents()) {
+        const auto value = parse(document);
+        CHECK(dump(parseLazy(document), value) == dump(value));
+        CHECK(dump(parseLazy(document).materialize()) == dump(value));
+    }
+}
+
+SIMPLE_JSON_TEST(truncatedInputThrows) {
+    for (const auto* input : { "", "[", "{", "[1", "[\"a", "[\"a\\", "{\"a\"", "{\"a\":", "{\"a\":[1" }) {
+        CHECK_THROWS(parse(input), Exception);
+        std::istringstream stream(input);
+        CHECK_THROWS(parse(stream), Exception);
+        CHECK_THROWS(Document(input), Exception);
+        CHECK_THROWS(Tape(input), Exception);
+    }
+}
+
+SIMPLE_JSON_TEST(compactMatchesParse) {
+    for (const auto& document : documents()) {
+        CHECK(dump(parseCompact(document)) == dump(parse(document)));
+    }
+}
+
+SIMPLE_JSON_TEST(duplicateKeysMatchParse) {
+    const std::string_view data = R"({"a": 1, "b": [true], "a": "two", "b": null, "a": {"c": 3}})";
+    const auto value = parse(data);
+    const auto& object = value.as<ValueType::Object>();
+    CHECK(dump(object.find("a")->second) == dump(parse(R"({"c": 3})")));
+    const auto integers = parseLazy(R"({"a": 1, "b": 3, "a": 2})").as<ValueType::Object>();
+    for (int i = 0; i < 3; ++i) {
+        CHECK(integers.getBang<ValueType::Int>("a") == 2);
+    }
+
+    const auto document = Document(data);
+    const auto tape     = Tape(data);
+    const auto compact  = parseCompact(data);
+    const auto lazy     = parseLazy(data).as<ValueType::Object>();
+    for (const std::string_view key : { "a", "b" }) {
+        const auto expected = dump(object.find(key)->second);
+        CHECK(dump(document.getRoot().as<ValueType::Object>().find(key)->second) == expected);
+        CHECK(dump(*tape.getRoot().as<ValueType::Object>().find(key)) == expected);
+        CHECK(dump(*compact.as<ValueType::Object>().find(key)) == expected);
+        // Repeated lookups do not depend on the previous ones.
+        for (int i = 0; i < 2; ++i) {
+            CHECK(dump(*lazy.find(key), object.find(key)->second) == expected);
+        }
+    }
+}
+
+SIMPLE_JSON_TEST(strictMatchesParse) {
+    for (const auto& document : documents()) {
+        CHECK(dump(parseStrict(document)) == dump(parse(document)));
+        CHECK(isValid(document));
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * A handler counting the reported values.
+ */
+struct Counter {
+    /** The amount of reported values.  */
+    std::size_t values = 0;
+    /** The last reported string.       */
+    std::string last;
+
+    inline void startObject()                  {}
+    inline void endObject()                    { ++values;           }
+    inline void startArray()                   {}
+    inline void endArray()                     { ++values;           }
+    inline void key(std::string_view)          {}
+    inline void string(std::string_view s)     { ++values; last = s; }
+    inline void integer(long)                  { ++values;           }
+    inline void unsignedInteger(unsigned long) { ++values;           }
+    inline void floating(double)               { ++values;           }
+    inline void boolean(bool)                  { ++values;           }
+    inline void null()                         { ++values;           }
+};
+
+/**
+ * Parses the given data in chunks of the given size.
+ *
+ * @param data the data
+ * @param chunkSize the size of the chunks
+ * @return the parsed value
+ */
+static auto pushParse(std::string_view data, std::size_t chunkSize) -> Value {
+    auto parser = PushParser();
+    for (std::size_t offset = 0; offset < data.size(); offset += chunkSize) {
+        parser.feed(data.substr(offset, chunkSize));
+    }
+    return parser.finish();
+}
+
+SIMPLE_JSON_TEST(pushMatchesParse) {
+    for (const std::size_t chunkSize : { 1, 7, 64, 4096 }) {
+        for (const auto& document : documents()) {
+            CHECK(dump(pushParse(document, chunkSize)) == dump(parse(document)));
+        }
+    }
+}
+
+SIMPLE_JSON_TEST(pushResumesCutLexemes) {
+    auto counter = Counter();
+    auto reader  = PushReader<Counter>(counter);
+    CHECK(reader.feed(R"(["a\)") == 4);
+    CHECK(reader.feed(R"(nb\u00)") == 6);
+    CHECK(reader.feed(R"(e9", tr)") == 7);
+    CHECK(counter.values == 1 && counter.last == "a\nb\xc3\xa9");
+    CHECK(reader.feed("ue, 12") == 6);
+    CHECK(counter.values == 2);
+    CHECK(reader.feed("3]") == 2);
+    CHECK(counter.values == 4 && reader.isDone());
+    reader.finish();
+}
+
+SIMPLE_JSON_TEST(pushStopsAfterTheRoot) {
+    auto counter = Counter();
+    auto reader  = PushReader<Counter>(counter);
+    const std::string_view data = R"( [1] {"a": null} rest)";
+    const auto consumed = reader.feed(data);
+    CHECK(consumed == 4 && reader.isDone());
+    CHECK(reader.feed(data.substr(consumed)) == 0);
+    reader.finish();
+
+    CHECK(reader.feed(data.substr(consumed)) == 12 && reader.isDone());
+    CHECK(counter.values == 4);
+    reader.finish();
+    CHECK(reader.getPosition() == 0);
+}
+
+SIMPLE_JSON_TEST(pushThrowsOnIncompleteInput) {
+    for (const auto* input : { "", " ", "[", "{\"a\"", "{\"a\": 1,", "[\"abc", "[tru", "[1}", "{\"a\": 1]", "[1,,]" }) {
+        CHECK_THROWS(pushParse(input, 1), Exception);
+        CHECK_THROWS(pushParse(input, 4096), Exception);
+        CHECK_THROWS(parse(input), Exception);
+    }
+}
+
+/**
+ * Returns the message of the exception thrown when parsing the given data in
+ * chunks of the given size, or an empty string if the parsing succeeded.
+ *
+ * @param data the data
+ * @param chunkSize the size of the chunks
+ * @return the message of the exception
+ */
+static auto pushError(std::string_view data, std::size_t chunkSize) -> std::string {
+    try {
+        pushParse(data, chunkSize);
+    } catch (const Exception& exception) {
+        return exception.what();
+    }
+    return "";
+}
+
+/**
+ * Returns the message of the exception thrown when parsing the given data, or
+ * an empty string if the parsing succeeded.
+ *
+ * @param data the data
+ * @return the message of the exception
+ */
+static auto parseError(std::string_view data) -> std::string {
+    try {
+        parse(data);
+    } catch (const Exception& exception) {
+        return exception.what();
+    }
+    return "";
+}
+
+SIMPLE_JSON_TEST(pushErrorsMatchParse) {
+    std::vector<std::string> inputs = {
+        "", " ", "x", "[", "{", "[f", "[1", "[-", "[1x", "[\"a", "[\"a\\", "[\"\\x\"]", "{\"a\"", "{\"a\":",
+        "{\"a\":1", "{\"a\":1,", "{a:1}", "{\"a\" 1}", "{\"a\":}", "[1,,]", "[}", "[:]", "{\"a\":[", "[tru",
+        "[true", "[nul]", "{\"a\":1,,}"
+    };
+    for (const auto& document : documents()) {
+        if (document.size() > 256) {
+            continue;
+        }
+        for (std::size_t length = 0; length < document.size(); ++length) {
+            inputs.push_back(document.substr(0, length));
+        }
+        for (std::size_t position = 0; position < document.size(); position += 3) {
+            for (const char replacement : { ',', ']', '}', ':', '"', '\\', 'x' }) {
+                auto mutated = document;
+                mutated[position] = replacement;
+                inputs.push_back(std::move(mutated));
+            }
+        }
+    }
+    for (const auto& input : inputs) {
+        const auto expected = parseError(input);
+        for (const std::size_t chunkSize : { 1, 5, 4096 }) {
+            const auto got = pushError(input, chunkSize);
+            if (got != expected) {
+                fail((input + ": \"" + got + "\" instead of \"" + expected + "\"").c_str(), __FILE__, __LINE__);
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * Serializes the given values into a compact JSON array.
+ *
+ * @param values the values
+ * @return the serialized values
+ */
+static auto dump(const std::vector<Value>& values) -> std::string {
+    std::string toReturn = "[";
+    for (const auto& value : values) {
+        toReturn += (toReturn.size() > 1 ? "," : "") + serialize(value);
+    }
+    return toReturn + "]";
+}
+
+/**
+ * Returns the message of the exception thrown when compiling the given path.
+ *
+ * @param path the path
+ * @return the message or an empty string if the path was compiled
+ */
+static auto compileError(std::string_view path) -> std::string {
+    try {
+        (void) Query({ path });
+    } catch (const Exception& exception) {
+        return exception.what();
+    }
+    return "";
+}
+
+SIMPLE_JSON_TEST(queryPointerEscapes) {
+    const auto data = R"({"a/b": 1, "m~n": 2, "~1": 3, "": {"": 4}})";
+    CHECK(dump(query(data, "/a~1b")) == "[1]");
+    CHECK(dump(query(data, "/m~0n")) == "[2]");
+    CHECK(dump(query(data, "/~01")) == "[3]");
+    CHECK(dump(query(data, "/~1")) == "[]");
+    CHECK(dump(query(data, "//")) == "[4]");
+    CHECK(dump(query(data, "")) == dump(std::vector<Value> { parse(data) }));
+
+    CHECK(compileError("/a~2").find("position: 3") != std::string::npos);
+    CHECK(compileError("/a/b~").find("position: 5") != std::string::npos);
+}
+
+SIMPLE_JSON_TEST(queryIndexAndKeyTokens) {
+    const auto data = R"({"0": "key", "list": ["a", "b"], "object": {"1": "one"}})";
+    CHECK(dump(query(data, "/list/1")) == R"(["b"])");
+    CHECK(dump(query(data, "/object/1")) == R"(["one"])");
+    CHECK(dump(query(data, "/0")) == R"(["key"])");
+    CHECK(dump(query(data, "/list/01")) == "[]");
+
+    CHECK(dump(query(data, "list.1")) == R"(["b"])");
+    CHECK(dump(query(data, "list[1]")) == R"(["b"])");
+    CHECK(dump(query(data, "list[1][0]")) == "[]");
+    CHECK(dump(query(data, "object.1")) == "[]");
+    CHECK(dump(query(data, "object[1]")) == "[]");
+    CHECK(dump(query(data, "list.2")) == "[]");
+}
+
+SIMPLE_JSON_TEST(queryWildcards) {
+    const auto data = R"({"users": [{"name": "a", "tags": ["x", "y"]}, {"name": "b", "tags": []}],
+                          "meta": {"owner": {"name": "c"}, "count": 2}})";
+    CHECK(dump(query(data, "users[*].name")) == R"(["a","b"])");
+    CHECK(dump(query(data, "users.*.tags[0]")) == R"(["x"])");
+    CHECK(dump(query(data, "users[*].tags[*]")) == R"(["x","y"])");
+    CHECK(dump(query(data, "*.*.name")) == R"(["a","b","c"])");
+    CHECK(dump(query(data, "meta.*")) == R"([{"name":"c"},2])");
+    CHECK(dump(query(data, "*[1].name")) == R"(["b"])");
+    CHECK(dump(query(data, "*.*.*.*")) == R"(["x","y"])");
+}
+
+SIMPLE_JSON_TEST(querySharedPrefixes) {
+    const auto data = R"({"users": [{"name": "a", "tags": ["x"]}, {"name": "b", "tags": ["y", "z"]}],
+                          "total": 2})";
+    const std::vector<std::string_view> paths = {
+        "users", "users[0].name", "users[*].name", "/users/1/name", "users[1]", "users.*.tags.*", "total", "/users/1"
+    };
+    const auto results = Query(paths).evaluate(data);
+    CHECK(results.size() == paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        CHECK(dump(results[i]) == dump(query(data, paths[i])));
+    }
+    CHECK(dump(results[1]) == R"(["a"])");
+    CHECK(dump(results[2]) == R"(["a","b"])");
+    CHECK(dump(results[3]) == R"(["b"])");
+    CHECK(dump(results[5]) == R"(["x","y","z"])");
+    CHECK(dump(results[4]) == dump(results[7]));
+
+    std::vector<std::pair<std::size_t, std::string>> order;
+    Query({ "users[1]", "users[1].tags[0]", "users[*].tags" }).run(data, [&order](std::size_t path, Value& value) {
+        order.emplace_back(path, serialize(value));
+    });
+    CHECK(order.size() == 4);
+    CHECK(order[0] == std::make_pair(std::size_t(2), std::string(R"(["x"])")));
+    CHECK(order[1].first == 0);
+    CHECK(order[2] == std::make_pair(std::size_t(2), std::string(R"(["y","z"])")));
+    CHECK(order[3] == std::make_pair(std::size_t(1), std::string(R"("y")")));
+}
+
+SIMPLE_JSON_TEST(queryRejectsMalformedPaths) {
+    CHECK(compileError("a[*]x").find("position: 5") != std::string::npos);
+    CHECK(compileError("a[0]b.c").find("position: 5") != std::string::npos);
+    CHECK(compileError("a[x]").find("position: 3") != std::string::npos);
+    CHECK(compileError("a[").find("position: 3") != std::string::npos);
+    CHECK(compileError("a..b").find("position: 3") != std::string::npos);
+    CHECK(compileError("a.").find("position: 3") != std::string::npos);
+    CHECK_THROWS(query("{}", "a[*]x"), Exception);
+
+    CHECK(compileError("a[*].x").empty());
+    CHECK(compileError("a[*][0]").empty());
+    CHECK(compileError("a.[0]").empty());
+}
+
+SIMPLE_JSON_TEST(queryReportsMalformedData) {
+    CHECK_THROWS(query(R"({"a": [1, 2)", "a[0]"), Exception);
+    CHECK_THROWS(query(R"({"a": {"b": 1)", "a"), Exception);
+    CHECK_THROWS(query(R"({"a" 1})", "b"), Exception);
+    CHECK_THROWS(query("", "a"), Exception);
+}
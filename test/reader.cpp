@@ -0,0 +1,175 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * A handler writing the reported elements in the canonical format of @c dump .
+ */
+class Recorder {
+    /** Whether the open containers are arrays. */
+    std::vector<bool> containers;
+
+    /**
+     * Appends the separator following a complete value.
+     */
+    inline void separate() {
+        if (!containers.empty()) {
+            text += ',';
+        }
+    }
+
+    /**
+     * Appends the given string.
+     *
+     * @param string the string
+     */
+    inline void append(std::string_view string) {
+        text += '"';
+        text += std::to_string(string.size());
+        text += ':';
+        text += string;
+        text += '"';
+    }
+
+    /**
+     * Appends the given number formatted using the given format.
+     *
+     * @param format the format
+     * @param value the number
+     */
+    template<typename T>
+    inline void number(const char* format, T value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), format, value);
+        text += buffer;
+        separate();
+    }
+
+public:
+    /** The recorded text. */
+    std::string text;
+
+    inline void startObject()                        { text += '{'; containers.push_back(false);       }
+    inline void endObject()                          { text += '}'; containers.pop_back(); separate(); }
+    inline void startArray()                         { text += '['; containers.push_back(true);        }
+    inline void endArray()                           { text += ']'; containers.pop_back(); separate(); }
+    inline void key(std::string_view name)           { append(name); text += ':';                      }
+    inline void string(std::string_view s)           { append(s); separate();                          }
+    inline void integer(long value)                  { number("i%ld", value);                          }
+    inline void unsignedInteger(unsigned long value) { number("u%lu", value);                          }
+    inline void floating(double value)               { number("d%.17g", value);                        }
+    inline void boolean(bool value)                  { text += value ? "true" : "false"; separate();   }
+    inline void null()                               { text += "null"; separate();                     }
+};
+
+SIMPLE_JSON_TEST(handlerMatchesParse) {
+    for (const auto& document : documents()) {
+        auto recorder = Recorder();
+        parse(std::string_view(document), recorder);
+        CHECK(recorder.text == dump(parse(document)));
+
+        auto streamed = Recorder();
+        auto stream   = std::istringstream(document);
+        parse(stream, streamed);
+        CHECK(streamed.text == recorder.text);
+    }
+}
+
+/**
+ * Returns the message of the exception thrown when parsing the given data, or
+ * an empty string if the parsing succeeded.
+ *
+ * @param data the data
+ * @return the message of the exception
+ */
+static auto parseError(std::string_view data) -> std::string {
+    try {
+        parse(data);
+    } catch (const Exception& exception) {
+        return exception.what();
+    }
+    return "";
+}
+
+SIMPLE_JSON_TEST(mismatchedBracketsThrow) {
+    // An empty token in front of the wrong closing bracket used to be read as a value again and again.
+    for (const auto* input : { "[1}", "[1 }", "[[1}]", "{\"a\": 1]", "{\"a\": [1, 2}}", "[true}", "[1,}" }) {
+        CHECK_THROWS(parse(input), Exception);
+        auto recorder = Recorder();
+        CHECK_THROWS(parse(std::string_view(input), recorder), Exception);
+        std::istringstream stream(input);
+        CHECK_THROWS(parse(stream, recorder), Exception);
+    }
+    CHECK(parseError("[1}") == "Unexpected '}', position: 3");
+}
+
+/**
+ * Returns the given amount of arrays nested in each other.
+ *
+ * @param levels the amount of arrays
+ * @return the nested arrays
+ */
+static auto nestedArrays(std::size_t levels) -> std::string {
+    return std::string(levels, '[') + std::string(levels, ']');
+}
+
+SIMPLE_JSON_TEST(deepNestingIsRejected) {
+    const auto deepest = nestedArrays(Reader<NullHandler>::maxDepth);
+    CHECK(parse(deepest).as<ValueType::Array>().size() == 1);
+    CHECK(Document(std::string_view(deepest)).getRoot().as<ValueType::Array>().size() == 1);
+    CHECK(tryParse(deepest).hasValue());
+
+    std::string objects;
+    for (std::size_t i = 0; i < 100000; ++i) {
+        objects += "{\"a\": ";
+    }
+    objects += '1' + std::string(100000, '}');
+    // The opening bracket exceeding the maximum depth is reported.
+    const std::pair<std::string, long long> tooDeep[] = {
+        { nestedArrays(Reader<NullHandler>::maxDepth + 1), 1024     },
+        { nestedArrays(100000),                            1024     },
+        { objects,                                         1024 * 6 },
+    };
+    for (const auto& [data, position] : tooDeep) {
+        CHECK_THROWS(parse(data), Exception);
+        CHECK_THROWS(Document(std::string_view(data)), Exception);
+        CHECK_THROWS(Tape(data), Exception);
+        CHECK_THROWS(parseCompact(data), Exception);
+
+        const auto result = tryParse(data);
+        CHECK(!result.hasValue() && result.error().code == ErrorCode::TooDeep);
+        CHECK(result.error().position == position);
+
+        auto stream = std::istringstream(data);
+        CHECK(!tryParse(stream).hasValue() && stream.fail());
+
+        auto parser = PushParser();
+        CHECK_THROWS(parser.feed(data), Exception);
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(tryParseMatchesParse) {
+    for (const auto& document : documents()) {
+        const auto result = tryParse(document);
+        CHECK(result.hasValue() && dump(*result) == dump(parse(document)));
+
+        auto stream = std::istringstream(document);
+        const auto streamed = tryParse(stream);
+        CHECK(streamed.hasValue() && dump(*streamed) == dump(*result));
+    }
+    for (const auto* invalid : { "", "[", "{", "[1,", "{\"a\"", "{\"a\":", "[tru]", "[\"\\x\"]", "[1.]", "[01x]" }) {
+        const auto result = tryParse(invalid);
+        CHECK(!result.hasValue());
+        try {
+            parse(invalid);
+            CHECK(!"parse did not throw");
+        } catch (const Exception& exception) {
+            CHECK(result.error().message() == exception.what());
+            CHECK(exception.getCode() == result.error().code);
+            CHECK(exception.getPosition() == result.error().position);
+            CHECK(exception.getError().message() == exception.what());
+        }
+    }
+}
+
+SIMPLE_JSON_TEST(tryParseReportsErrorCodes) {
+    const auto check = [](std::string_view data, ErrorCode code, long long position) {
+        const auto result = tryParse(data);
+        return !result.hasValue() && result.error().code == code && result.error().position == position;
+    };
+    CHECK(check("[1 x]",       ErrorCode::InvalidLiteral,      3));
+    CHECK(check("[1, 2",       ErrorCode::UnexpectedEnd,       5));
+    CHECK(check("{\"a\" 1}",   ErrorCode::UnexpectedCharacter, 5));
+    CHECK(check("[\"\\q\"]",   ErrorCode::InvalidEscape,       2));
+    CHECK(check("[-]",         ErrorCode::InvalidNumber,       1));
+
+    const auto result = tryParse("[1,");
+    CHECK(result.valueOr(parse("[7]")).as<ValueType::Array>().size() == 1);
+    CHECK_THROWS(result.value(), Exception);
+    try {
+        (void) result.value();
+    } catch (const Exception& exception) {
+        CHECK(exception.getCode() == ErrorCode::UnexpectedEnd && exception.getPosition() == 3);
+    }
+}
+
+SIMPLE_JSON_TEST(exceptionsCarryTheError) {
+    const auto error = [](auto&& function) {
+        try {
+            function();
+        } catch (const Exception& exception) {
+            return exception.getError();
+        }
+        return Error { ErrorCode::TrailingCharacters, -1 };
+    };
+    auto e = error([] { parse("[1 x]"); });
+    CHECK(e.code == ErrorCode::InvalidLiteral && e.position == 3 && e.got == 'x');
+    e = error([] { parse("{\"a\" 1}"); });
+    CHECK(e.code == ErrorCode::UnexpectedCharacter && e.position == 5 && e.expected == ':' && e.got == '1');
+    e = error([] { parseLazy(" x"); });
+    CHECK(e.code == ErrorCode::UnexpectedCharacter && e.position == 1 && e.expected == '{' && e.got == 'x');
+    e = error([] { parseLazy(""); });
+    CHECK(e.code == ErrorCode::UnexpectedEnd && e.position == 0);
+    e = error([] { Document("[1, 2"); });
+    CHECK(e.code == ErrorCode::UnexpectedEnd && e.position == 5);
+    e = error([] { parseCompact("[\"\\q\"]"); });
+    CHECK(e.code == ErrorCode::InvalidEscape && e.position == 2);
+    e = error([] {
+        auto parser = PushParser();
+        parser.feed("[-");
+        parser.feed("]");
+    });
+    CHECK(e.code == ErrorCode::InvalidNumber && e.position == 1);
+}
+
+SIMPLE_JSON_TEST(tryAsDoesNotThrow) {
+    const auto value = parse(R"(["text", 1, null, {"a": 2}])");
+    const auto& array = value.as<ValueType::Array>();
+    CHECK(array.at(0).tryAs<ValueType::String>() != nullptr && *array.at(0).tryAs<ValueType::String>() == "text");
+    CHECK(array.at(0).tryAs<ValueType::Int>() == nullptr);
+    CHECK(array.at(1).tryAs<ValueType::Int>() != nullptr && *array.at(1).tryAs<ValueType::Int>() == 1);
+    CHECK(array.at(1).tryAs<ValueType::Double>() == nullptr);
+    CHECK(array.at(2).tryAs<ValueType::Object>() == nullptr);
+    CHECK(array.at(3).tryAs<ValueType::Object>() != nullptr);
+
+    CHECK(array.at(0).tryAsStringView() == "text");
+    CHECK(!array.at(1).tryAsStringView().has_value());
+    CHECK(!array.at(2).tryAsStringView().has_value());
+
+    const auto document = Document(R"(["borrowed", "with \"escapes\""])");
+    const auto& elements = document.getRoot().as<ValueType::Array>();
+    CHECK(elements.at(0).tryAsStringView() == "borrowed");
+    CHECK(elements.at(1).tryAsStringView() == "with \"escapes\"");
+}
+
+SIMPLE_JSON_TEST(objectTryAccessors) {
+    const auto object = Object(parse(R"({"string": "s", "int": 1, "null": null, "object": {"inner": true}})"));
+    CHECK(object.tryGet<ValueType::Int>("int") != nullptr && *object.tryGet<ValueType::Int>("int") == 1);
+    CHECK(object.tryGet<ValueType::Int>("string") == nullptr);
+    CHECK(object.tryGet<ValueType::Int>("missing") == nullptr);
+    CHECK(object.tryGet<long>("int") != nullptr && *object.tryGet<long>("int") == 1);
+    CHECK(object.tryGet<long>("null") == nullptr);
+
+    CHECK(object.tryGetStringView("string") == "s");
+    CHECK(!object.tryGetStringView("int").has_value());
+    CHECK(!object.tryGetStringView("missing").has_value());
+
+    const auto inner = object.tryGetObject("object");
+    CHECK(inner.has_value() && inner->tryGet<ValueType::Bool>("inner") != nullptr);
+    CHECK(!object.tryGetObject("string").has_value());
+    CHECK(!object.tryGetObject("missing").has_value());
+}
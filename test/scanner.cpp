@@ -0,0 +1,129 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SimpleJSON/scanner.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+
+/**
+ * Collects the positions of the structural characters outside of strings one
+ * character at a time. Like the scanner, backslashes outside of strings escape
+ * the following character as well.
+ *
+ * @param data the JSON data
+ * @param positions the vector the positions are appended to
+ * @return whether all strings are terminated
+ */
+static auto indexSlowly(std::string_view data, std::vector<std::size_t>& positions) -> bool {
+    auto inString = false, escaped = false;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const auto c = data[i];
+        if (c == '"' && !escaped) {
+            inString = !inString;
+        } else if (!inString && c != '\0' && std::strchr("{}[]:,", c) != nullptr) {
+            positions.push_back(i);
+        }
+        escaped = c == '\\' && !escaped;
+    }
+    return !inString;
+}
+
+SIMPLE_JSON_TEST(scannerClassifiesEveryByte) {
+    auto random = std::mt19937(7);
+    char block[scanner::blockSize];
+    for (int round = 0; round < 1000; ++round) {
+        for (auto& c : block) {
+            c = static_cast<char>(random());
+        }
+        const auto masks = scanner::classify(block);
+        for (std::size_t i = 0; i < scanner::blockSize; ++i) {
+            const auto bit = std::uint64_t(1) << i;
+            const auto c   = block[i];
+            CHECK(((masks.quotes & bit) != 0)      == (c == '"'));
+            CHECK(((masks.backslashes & bit) != 0) == (c == '\\'));
+            CHECK(((masks.structurals & bit) != 0) == (c != '\0' && std::strchr("{}[]:,", c) != nullptr));
+            CHECK(((masks.whitespaces & bit) != 0) == scanner::isWhitespace(c));
+        }
+    }
+    const auto name = std::string_view(scanner::implementationName());
+    CHECK(name == "avx2" || name == "sse2" || name == "fallback");
+}
+
+SIMPLE_JSON_TEST(scannerSkipsWhitespaceRuns) {
+    const std::string_view spaces = " \t\r\n";
+    for (std::size_t offset = 0; offset < 8; ++offset) {
+        for (std::size_t length = 0; length < 200; ++length) {
+            std::string data(offset, 'x');
+            for (std::size_t i = 0; i < length; ++i) {
+                data += spaces[i % spaces.size()];
+            }
+            data += "x  ";
+            const auto begin = data.data() + offset;
+            CHECK(scanner::skipWhitespaces(begin, data.data() + data.size()) == begin + length);
+            // The end of the range stops the run, even if whitespaces follow.
+            CHECK(scanner::skipWhitespaces(begin, begin + length / 2) == begin + length / 2);
+        }
+    }
+}
+
+SIMPLE_JSON_TEST(scannerIndexesStructurals) {
+    std::vector<std::string> inputs = {
+        "", "{}", R"({"a": [1, 2], "b": "x,y:z"})", R"(["\"]", "\\", "\\\"", ","])", R"(["unterminated, ])",
+        R"(["\\\\"] [])"
+    };
+    // Quotes and backslashes around the block boundaries.
+    for (std::size_t length = 55; length < 140; ++length) {
+        inputs.push_back("[\"" + std::string(length, '\\') + "\", {}]");
+        inputs.push_back("[\"" + std::string(length, 'a') + "\\\"\", [], \"\"]");
+    }
+    auto random = std::mt19937(11);
+    for (int round = 0; round < 500; ++round) {
+        std::string input;
+        for (auto length = random() % 300; length > 0; --length) {
+            input += "\"\\{}[]:, a"[random() % 10];
+        }
+        inputs.push_back(std::move(input));
+    }
+    for (const auto& input : inputs) {
+        std::vector<std::size_t> expected, got;
+        const auto terminated = indexSlowly(input, expected);
+        CHECK(scanner::indexStructurals(input, got) == terminated);
+        CHECK(got == expected);
+
+        // Indexed in pieces of whole blocks carrying the state.
+        for (const std::size_t pieceSize : { scanner::blockSize, 2 * scanner::blockSize }) {
+            std::vector<std::size_t> pieces;
+            auto state = scanner::IndexState();
+            for (std::size_t offset = 0; offset < input.size(); offset += pieceSize) {
+                std::vector<std::size_t> positions;
+                scanner::indexStructurals(std::string_view(input).substr(offset, pieceSize), positions, state);
+                for (const auto position : positions) {
+                    pieces.push_back(offset + position);
+                }
+            }
+            CHECK(pieces == expected);
+            CHECK((state.inString == 0) == terminated);
+        }
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(sharedCopiesAreShared) {
+    const auto value = parse(R"({"a":[1,2,3],"b":{"c":"d"}})");
+    auto modified = value;
+    CHECK(value.as<ValueType::Object>().isShared());
+
+    std::get<ObjectContent>(modified.value).insert_or_assign("a", Value { ValueType::Int, 7L });
+    CHECK(!value.as<ValueType::Object>().isShared());
+    CHECK(value.as<ValueType::Object>().at("b").as<ValueType::Object>().isShared());
+    CHECK(dump(value) == dump(parse(R"({"a":[1,2,3],"b":{"c":"d"}})")));
+    CHECK(dump(modified) == dump(parse(R"({"a":7,"b":{"c":"d"}})")));
+}
+
+SIMPLE_JSON_TEST(sharedDocumentCopiesAreDeep) {
+    const auto document = Document(R"({"a":[1,2,3]})");
+    const Value copy = document.getRoot();
+    CHECK(!copy.as<ValueType::Object>().isShared());
+    CHECK(!document.getRoot().as<ValueType::Object>().isShared());
+    CHECK(dump(copy) == dump(document.getRoot()));
+}
+
+SIMPLE_JSON_TEST(sharedObjectReferenceBeforeCopy) {
+    ObjectContent a;
+    a["k"] = Value(ValueType::Int, 1L);
+    auto& reference = a["k"];
+    const ObjectContent b = a;
+    reference = Value(ValueType::Int, 2L);
+    CHECK(b.at("k").as<ValueType::Int>() == 1);
+    CHECK(a.at("k").as<ValueType::Int>() == 2);
+
+    auto iterator = a.mutableBegin();
+    const ObjectContent c = a;
+    iterator->second = Value(ValueType::Int, 3L);
+    CHECK(c.at("k").as<ValueType::Int>() == 2);
+
+    auto& atReference = a.at("k");
+    const ObjectContent d = a;
+    atReference = Value(ValueType::Int, 4L);
+    CHECK(d.at("k").as<ValueType::Int>() == 3);
+    CHECK(a.at("k").as<ValueType::Int>() == 4);
+}
+
+SIMPLE_JSON_TEST(sharedArrayIteratorBeforeCopy) {
+    ArrayContent a { Value(ValueType::Int, 1L), Value(ValueType::Int, 2L) };
+    auto iterator = a.mutableBegin();
+    const ArrayContent b = a;
+    *iterator = Value(ValueType::Int, 3L);
+    CHECK(b[0].as<ValueType::Int>() == 1);
+    CHECK(a[0].as<ValueType::Int>() == 3);
+
+    auto& reference = a[1];
+    const ArrayContent c = a;
+    reference = Value(ValueType::Int, 4L);
+    CHECK(c[1].as<ValueType::Int>() == 2);
+
+    auto& back = a.emplace_back(ValueType::Int, 5L);
+    const ArrayContent d = a;
+    back = Value(ValueType::Int, 6L);
+    CHECK(d[2].as<ValueType::Int>() == 5);
+}
+
+SIMPLE_JSON_TEST(sharedAgainAfterClear) {
+    ArrayContent a { Value(ValueType::Int, 1L) };
+    a.mutableBegin();
+    const ArrayContent b = a;
+    CHECK(!a.isShared() && !b.isShared());
+    a.clear();
+    a.push_back(Value(ValueType::Int, 2L));
+    const ArrayContent c = a;
+    CHECK(a.isShared() && c.isShared());
+}
+
+SIMPLE_JSON_TEST(sharedReadConcurrently) {
+    const auto value = parse(documents()[20]);
+    const auto expected = dump(value);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([copy = value, &expected] {
+            for (int j = 0; j < 100; ++j) {
+                const auto again = copy;
+                CHECK(dump(again) == expected);
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    CHECK(dump(value) == expected);
+}
+
+SIMPLE_JSON_TEST(sharedWrittenWhileCopyIsRead) {
+    ObjectContent a;
+    a["k"] = Value(ValueType::Int, 1L);
+    auto& reference = a["k"];
+    const ObjectContent b = a;
+    auto reader = std::thread([&b] {
+        for (int i = 0; i < 1000; ++i) {
+            CHECK(b.at("k").as<ValueType::Int>() == 1);
+        }
+    });
+    for (long i = 0; i < 1000; ++i) {
+        reference = Value(ValueType::Int, i + 2);
+    }
+    reader.join();
+}
+
+SIMPLE_JSON_TEST(sharedIterationIsReadOnly) {
+    auto object = parse(R"({"a": [1, 2, 3], "b": {"c": true}})").as<ValueType::Object>();
+    const auto objectCopy = object;
+    std::size_t sum = 0;
+    for (const auto& [key, member] : object) {
+        sum += key.size();
+    }
+    for (auto member = object.rbegin(); member != object.rend(); ++member) {
+        sum += member->first.size();
+    }
+    CHECK(object.isShared() && object.data() == objectCopy.data());
+
+    auto array = objectCopy.at("a").as<ValueType::Array>();
+    const auto arrayCopy = array;
+    for (const auto& element : array) {
+        sum += static_cast<std::size_t>(element.as<ValueType::Int>());
+    }
+    CHECK(sum == 10);
+    CHECK(array.isShared() && std::as_const(array).data() == arrayCopy.data());
+
+    // Mutable iterators clone the shared elements.
+    array.mutableBegin();
+    CHECK(!array.isShared() && std::as_const(array).data() != arrayCopy.data());
+}
+
+SIMPLE_JSON_TEST(sharedContentComparesElements) {
+    auto ints = BasicArrayContent<int, std::allocator<int>> { 1, 2, 4 };
+    const auto copy = ints;
+    CHECK(ints == copy);
+    ints.insert(ints.cbegin() + 1, { 7, 8 });
+    ints.insert(ints.cend(), 2, 9);
+    ints.emplace(ints.cbegin(), 0);
+    CHECK(ints != copy);
+    CHECK(ints == (BasicArrayContent<int, std::allocator<int>> { 0, 1, 7, 8, 2, 4, 9, 9 }));
+    CHECK(*ints.rbegin() == 9 && ints.data()[3] == 8);
+    ints.data()[3] = 3;
+    CHECK(ints[3] == 3 && copy[2] == 4);
+
+    using Map = BasicObjectContent<int, std::allocator<int>>;
+    Map map;
+    CHECK(map.insert({ "a", 1 }).second);
+    CHECK(!map.insert({ "a", 2 }).second);
+    map.insert({ { "b", 2 }, { "a", 3 }, { "c", 3 } });
+    CHECK(map.at("a") == 1 && map.size() == 3 && map.data()[2].first == "c");
+    CHECK(map.rbegin()->first == "c");
+    Map reordered;
+    reordered.insert({ { "c", 3 }, { "a", 1 }, { "b", 2 } });
+    CHECK(map == reordered);
+    reordered.set("b", 4);
+    CHECK(map != reordered);
+}
+
+SIMPLE_JSON_TEST(sharedValuesCompareContents) {
+    for (const auto& document : documents()) {
+        const auto value = parse(document);
+        CHECK(value == parse(document));
+        CHECK(Document(std::string_view(document)).getRoot() == value);
+    }
+    const auto value = parse(R"({"a": [1, "b", null], "c": {"d": 1.5}})");
+    CHECK(value == parse(R"({"c": {"d": 1.5}, "a": [1, "b", null]})"));
+    CHECK(value != parse(R"({"a": [1, "b", null], "c": {"d": 2.5}})"));
+    CHECK(value != parse(R"({"a": [1, "b"], "c": {"d": 1.5}})"));
+    CHECK(value != parse(R"({"a": [1, "b", false], "c": {"d": 1.5}})"));
+    CHECK(parse("[1]") != parse("[1.0]"));
+}
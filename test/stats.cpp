@@ -0,0 +1,98 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <string>
+#include <string_view>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+#ifdef SIMPLE_JSON_STATS
+SIMPLE_JSON_TEST(statsCountTheParsedData) {
+    const std::string_view data = R"({"a": [1, 2.5, "x\n", true], "b": null, "long": "a string longer than the small buffer"})";
+    auto stats = ParseStats();
+    const auto value = parse(data, stats);
+    CHECK(dump(value) == dump(parse(data)));
+
+    CHECK(stats.bytes == data.size());
+    CHECK(stats.count(ValueType::Object) == 1);
+    CHECK(stats.count(ValueType::Array)  == 1);
+    CHECK(stats.count(ValueType::Int)    == 1);
+    CHECK(stats.count(ValueType::Double) == 1);
+    CHECK(stats.count(ValueType::String) == 2);
+    CHECK(stats.count(ValueType::Bool)   == 1);
+    CHECK(stats.count(ValueType::Null)   == 1);
+    CHECK(stats.maxDepth == 2);
+    CHECK(stats.escapes == 1);
+    CHECK(stats.stringBytes == std::string_view("ablong").size() + 2 + std::string_view("a string longer than the small buffer").size());
+    // The long string, the object and the array allocate.
+    CHECK(stats.allocations >= 3);
+    CHECK(stats.allocatedBytes > std::string_view("a string longer than the small buffer").size());
+
+    // The statistics accumulate.
+    const auto first = stats;
+    parse(data, stats);
+    CHECK(stats.bytes == 2 * first.bytes);
+    CHECK(stats.count(ValueType::String) == 2 * first.count(ValueType::String));
+    CHECK(stats.allocations == 2 * first.allocations);
+    CHECK(stats.maxDepth == first.maxDepth);
+}
+
+SIMPLE_JSON_TEST(statsOnlyCountInstrumentedParses) {
+    auto stats = ParseStats();
+    parse(R"([[1], {"a": "b"}])", stats);
+    const auto allocations = stats.allocations;
+    CHECK(allocations > 0);
+    parse(R"([[1], {"a": "b"}])");
+    CHECK(stats.allocations == allocations);
+    CHECK_THROWS(parse(R"([[1], {"a" "b"}])", stats), Exception);
+    // The part parsed before the error is counted.
+    CHECK(stats.count(ValueType::Array) == 4);
+}
+
+SIMPLE_JSON_TEST(statsCountDocuments) {
+    const std::string_view data = R"({"a": [1, 2.5, "x\n", true], "b": null, "long": "a string longer than the small buffer"})";
+    auto stats = ParseStats();
+    const auto document = Document(data, stats);
+    CHECK(dump(document.getRoot()) == dump(parse(data)));
+    CHECK(stats.bytes == data.size());
+    CHECK(stats.count(ValueType::Object) == 1);
+    CHECK(stats.count(ValueType::String) == 2);
+    CHECK(stats.maxDepth == 2);
+    CHECK(stats.escapes == 1);
+    // The strings are borrowed or stored in the first chunk of the arena.
+    CHECK(stats.allocations == 1);
+    CHECK(stats.allocatedBytes >= 4096);
+
+    // The growing arena allocates far less often than the heap.
+    std::string large = "[";
+    for (std::size_t i = 0; i < 10000; ++i) {
+        large += R"([1, {"a": "\n"}], )";
+    }
+    large += "null]";
+    auto heap  = ParseStats();
+    auto arena = ParseStats();
+    parse(large, heap);
+    (void) Document(std::string_view(large), arena);
+    CHECK(arena.count(ValueType::Object) == heap.count(ValueType::Object));
+    CHECK(arena.allocations > 1);
+    CHECK(arena.allocations * 100 < heap.allocations);
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <new>
+#include <sstream>
+#include <string>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "allocations.hpp"
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(manyMatchesParse) {
+    std::string concatenated;
+    for (const auto& document : documents()) {
+        concatenated += document;
+        concatenated += '\n';
+    }
+    auto stream = parseMany(concatenated);
+    Value value;
+    std::size_t i = 0;
+    while (stream.next(value)) {
+        CHECK(i < documents().size() && dump(value) == dump(parse(documents()[i])));
+        ++i;
+    }
+    CHECK(i == documents().size());
+
+    auto input = std::istringstream(concatenated);
+    auto streamed = parseMany(input);
+    for (i = 0; streamed.next(value); ++i) {
+        CHECK(dump(value) == dump(parse(documents()[i])));
+    }
+    CHECK(i == documents().size());
+}
+
+SIMPLE_JSON_TEST(manyIntoDefaultValue) {
+    // A default-initialized value keeps whatever type the storage contained before.
+    alignas(Value) unsigned char storage[sizeof(Value)];
+    for (const auto type : { ValueType::Array, ValueType::Object, ValueType::String }) {
+        (new (storage) Value { type, 0L })->~Value();
+        auto& value = *new (storage) Value;
+
+        auto stream = parseMany(R"([1, "a"] {"b": [2]})");
+        CHECK(stream.next(value));
+        CHECK(dump(value) == dump(parse(R"([1, "a"])")));
+        CHECK(stream.next(value));
+        CHECK(dump(value) == dump(parse(R"({"b": [2]})")));
+        CHECK(!stream.next(value));
+        value.~Value();
+    }
+}
+
+SIMPLE_JSON_TEST(manyReusesTheValue) {
+    std::string records;
+    for (int i = 0; i < 100; ++i) {
+        records += R"({"id": )" + std::to_string(i) + R"(, "text": "a text longer than the small-string buffer",)"
+                   R"( "tags": ["first tag of the record", "second tag of the record"]})" "\n";
+    }
+    auto stream = parseMany(records);
+    Value value;
+    CHECK(stream.next(value) && stream.next(value));
+
+    const auto counter = AllocationCounter();
+    long count = 2;
+    while (stream.next(value)) {
+        CHECK(ObjectView(value).getBang<ValueType::Int>("id") == count++);
+    }
+    CHECK(count == 100);
+    CHECK(counter.getCount() == 0);
+}
+
+SIMPLE_JSON_TEST(manyKeepsSharedContent) {
+    auto stream = parseMany(R"({"a": [1, 2]} {"b": "c"})");
+    Value value;
+    CHECK(stream.next(value));
+    const auto copy = value;
+    CHECK(stream.next(value));
+    CHECK(dump(copy) == dump(parse(R"({"a": [1, 2]})")));
+    CHECK(dump(value) == dump(parse(R"({"b": "c"})")));
+}
@@ -0,0 +1,120 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+#include <SimpleJSON/strings.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+
+/**
+ * Decodes the escape sequences of the given raw string content.
+ *
+ * @param raw the raw string content
+ * @param failure set to the offset of the invalid escape sequence, if any
+ * @return the decoded string or nothing if an escape sequence is invalid
+ */
+static auto decode(std::string_view raw, std::size_t* failure = nullptr) -> std::optional<std::string> {
+    std::string buffer(raw.size(), '\0');
+    auto begin = raw.data();
+    const auto last = strings::unescape(begin, raw.data() + raw.size(), buffer.data());
+    if (last == nullptr) {
+        if (failure != nullptr) *failure = static_cast<std::size_t>(begin - raw.data());
+        return std::nullopt;
+    }
+    buffer.resize(static_cast<std::size_t>(last - buffer.data()));
+    return buffer;
+}
+
+SIMPLE_JSON_TEST(unescapeSimpleEscapes) {
+    CHECK(decode("") == "");
+    CHECK(decode("plain") == "plain");
+    CHECK(decode(R"(\"\\\/\b\f\n\r\t)") == "\"\\/\b\f\n\r\t");
+    CHECK(decode(R"(a\u0041b\u00e9\u20ac)") == "aAb\xc3\xa9\xe2\x82\xac");
+    CHECK(decode(R"(\u0000)") == std::string(1, '\0'));
+}
+
+SIMPLE_JSON_TEST(unescapeSurrogates) {
+    CHECK(decode(R"(\ud83d\ude00)") == "\xf0\x9f\x98\x80");
+    CHECK(decode(R"(\uD83D\uDE00)") == "\xf0\x9f\x98\x80");
+    CHECK(decode(R"(\udbff\udfff)") == "\xf4\x8f\xbf\xbf");
+
+    // Unpaired surrogates are replaced by U+FFFD, the following text is kept.
+    const std::string replacement = "\xef\xbf\xbd";
+    CHECK(decode(R"(\ud83d)") == replacement);
+    CHECK(decode(R"(\ude00)") == replacement);
+    CHECK(decode(R"(\ud83dx)") == replacement + "x");
+    CHECK(decode(R"(\ud83d\u0041)") == replacement + "A");
+    CHECK(decode(R"(\ud83d\ud83d\ude00)") == replacement + "\xf0\x9f\x98\x80");
+    CHECK(decode(R"(\ude00\ud83d)") == replacement + replacement);
+    CHECK(decode(R"(\ud83d\n)") == replacement + "\n");
+}
+
+SIMPLE_JSON_TEST(unescapeRejectsInvalidEscapes) {
+    for (const auto& [raw, position] : {
+        std::pair<std::string_view, std::size_t> { R"(\x)", 0 }, { R"(ab\)", 2 }, { R"(\u12)", 0 },
+        { R"(a\u12g4)", 1 }, { R"(\u)", 0 }, { R"(\n\U0041)", 2 }, { R"(\ud83d\u12)", 6 }
+    }) {
+        std::size_t failure = ~std::size_t(0);
+        CHECK(!decode(raw, &failure).has_value());
+        CHECK(failure == position);
+    }
+}
+
+SIMPLE_JSON_TEST(unescapeAcrossBlockBoundaries) {
+    // The kernel searches 16 or 32 bytes at once, the escapes are moved across these blocks.
+    for (std::size_t offset = 0; offset < 70; ++offset) {
+        const auto prefix = std::string(offset, 'a');
+        for (const auto& [escape, decoded] : {
+            std::pair<std::string_view, std::string_view> { R"(\n)", "\n" }, { R"(\\)", "\\" }, { R"(\")", "\"" },
+            { R"(\u00e9)", "\xc3\xa9" }, { R"(\ud83d\ude00)", "\xf0\x9f\x98\x80" }
+        }) {
+            const auto raw = prefix + std::string(escape) + "bc" + std::string(escape);
+            CHECK(decode(raw) == prefix + std::string(decoded) + "bc" + std::string(decoded));
+
+            bool escaped;
+            const auto string = raw + "\"tail\"";
+            CHECK(strings::findEnd(string.data(), string.data() + string.size(), escaped) == string.data() + raw.size());
+            CHECK(escaped);
+        }
+        std::size_t failure;
+        CHECK(!decode(prefix + R"(\q)", &failure).has_value() && failure == offset);
+    }
+}
+
+SIMPLE_JSON_TEST(findEndOfStrings) {
+    bool escaped = true;
+    const std::string_view plain = R"(abc"def")";
+    CHECK(strings::findEnd(plain.data(), plain.data() + plain.size(), escaped) == plain.data() + 3);
+    CHECK(!escaped);
+
+    for (const std::string_view unterminated : { "abc", R"(abc\")", R"(abc\)", "" }) {
+        CHECK(strings::findEnd(unterminated.data(), unterminated.data() + unterminated.size(), escaped)
+              == unterminated.data() + unterminated.size());
+    }
+}
+
+SIMPLE_JSON_TEST(parseDecodesEscapes) {
+    const auto array = parse<ValueType::Array>(R"(["a\n\u00e9\"", "\ud83d"])");
+    CHECK(array.at(0).as<ValueType::String>() == "a\n\xc3\xa9\"");
+    CHECK(array.at(1).as<ValueType::String>() == "\xef\xbf\xbd");
+    CHECK_THROWS(parse(R"(["\x"])"), Exception);
+    CHECK_THROWS(parse(R"({"\u12": 1})"), Exception);
+}
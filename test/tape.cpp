@@ -0,0 +1,77 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+
+/**
+ * A user type constructed from a tape object.
+ */
+struct Point {
+    /** The horizontal coordinate. */
+    long x;
+    /** The vertical coordinate.   */
+    long y;
+
+    inline explicit Point(ObjectRef object): x(object.getBang<ValueType::Int>("x")), y(object.getBang<ValueType::Int>("y")) {}
+};
+
+SIMPLE_JSON_TEST(tapeObjectAccessors) {
+    const auto tape = Tape(R"({"name": "tape", "count": 3, "flag": true, "none": null,
+                               "point": {"x": 1, "y": -2}, "list": [1, "two", [3]]})");
+    const auto object = tape.getRoot().as<ValueType::Object>();
+    CHECK(object.size() == 6 && !object.empty());
+    CHECK(object.getBang<ValueType::String>("name") == "tape");
+    CHECK(object.get<ValueType::Int>("count") == 3);
+    CHECK(object.get<ValueType::Bool>("flag") == true);
+    CHECK(!object.get<ValueType::Int>("none").has_value());
+    CHECK(!object.get<ValueType::Int>("missing").has_value());
+    CHECK(!object.find("missing").has_value());
+    CHECK(object.find("none")->is(ValueType::Null));
+    CHECK(object.getObjectBang("point").getBang<ValueType::Int>("y") == -2);
+    CHECK(!object.getObject("none").has_value());
+    CHECK(object.maybeGetAs<Point>("point")->x == 1);
+    CHECK(!object.maybeGetAs<Point>("missing").has_value());
+
+    CHECK_THROWS(object.getBang<ValueType::Int>("missing"), std::out_of_range);
+    CHECK_THROWS(object.getBang<ValueType::Int>("name"), std::bad_variant_access);
+    CHECK_THROWS(object.getObject("list"), std::bad_variant_access);
+}
+
+SIMPLE_JSON_TEST(tapeArraysSkipNestedContainers) {
+    const auto tape  = Tape(R"([[1, [2, {"a": [3, 4]}], {}], "after", [], {"b": {"c": []}}, 5])");
+    const auto array = tape.getRoot().as<ValueType::Array>();
+    CHECK(array.size() == 5);
+    CHECK(array[0].as<ValueType::Array>().size() == 3);
+    CHECK(array[1].as<ValueType::String>() == "after");
+    CHECK(array[2].as<ValueType::Array>().empty());
+    CHECK(array[3].as<ValueType::Object>().getObjectBang("b").size() == 1);
+    CHECK(array[4].as<ValueType::Int>() == 5);
+
+    std::size_t count = 0;
+    for (const auto element : array) {
+        CHECK(element.is(array[count].getType()));
+        ++count;
+    }
+    CHECK(count == array.size());
+}
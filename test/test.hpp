@@ -0,0 +1,93 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#ifndef SimpleJSON_test_test_hpp
+#define SimpleJSON_test_test_hpp
+
+#include <string>
+#include <vector>
+
+namespace simple_json::test {
+/**
+ * A registered test case.
+ */
+struct Case {
+    /** The name of the test case. */
+    const char* name;
+    /** The test function.         */
+    void (*function)();
+};
+
+/**
+ * Returns the registered test cases.
+ *
+ * @return the test cases in the order of their registration
+ */
+auto cases() -> std::vector<Case>&;
+
+/**
+ * Registers a test case during the static initialization.
+ */
+struct Registration {
+    inline Registration(const char* name, void (*function)()) {
+        cases().push_back({ name, function });
+    }
+};
+
+/**
+ * The exception thrown by a failed check.
+ */
+struct Failure {
+    /** The description of the failed check. */
+    std::string message;
+};
+
+/**
+ * Throws a failure for the given check.
+ *
+ * @param check the failed check
+ * @param file the file of the check
+ * @param line the line of the check
+ */
+[[noreturn]] void fail(const char* check, const char* file, int line);
+}
+
+/**
+ * Defines and registers a test case of the given name.
+ */
+#define SIMPLE_JSON_TEST(name)                                                                  \
+    static void name();                                                                         \
+    static const simple_json::test::Registration name##Registration(#name, name);               \
+    static void name()
+
+/**
+ * Checks that the given condition holds.
+ */
+#define CHECK(condition)                                                                        \
+    do {                                                                                        \
+        if (!(condition)) simple_json::test::fail(#condition, __FILE__, __LINE__);              \
+    } while (false)
+
+/**
+ * Checks that the given expression throws an exception of the given type.
+ */
+#define CHECK_THROWS(expression, type)                                                          \
+    do {                                                                                        \
+        auto thrown = false;                                                                    \
+        try { (void) (expression); } catch (const type&) { thrown = true; }                    \
+        if (!thrown) simple_json::test::fail(#expression " throws " #type, __FILE__, __LINE__); \
+    } while (false)
+
+#endif /* SimpleJSON_test_test_hpp */
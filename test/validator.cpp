@@ -0,0 +1,100 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <optional>
+#include <string>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/**
+ * Returns the error code of the validation of the given data.
+ *
+ * @param data the data to validate
+ * @return the error code or @c std::nullopt if the data is valid
+ */
+static inline auto codeOf(std::string_view data) -> std::optional<ErrorCode> {
+    const auto error = validate(data);
+    return error ? std::optional(error->code) : std::nullopt;
+}
+
+SIMPLE_JSON_TEST(validatorAcceptsValidData) {
+    for (const auto* valid : {
+        "{}", "[]", "0", "-0", "1.5", "-1.5e-3", "1E+2", "\"\"", "true", "false", "null", " [ 1 , 2 ] ",
+        R"({"a":{"b":[null,true,false,"\u00e9\ud83d\ude00\n\"\\\/"]}})", "[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"]",
+        "[1e400]", "[-325432.2036e86739]", "[1e-400]", "[123456789012345678901234567890]"
+    }) {
+        CHECK(isValid(valid));
+        CHECK(!codeOf(valid).has_value());
+    }
+    CHECK(isValid(std::string(1024, '[') + std::string(1024, ']')));
+}
+
+SIMPLE_JSON_TEST(validatorRejectsInvalidData) {
+    const std::pair<const char*, ErrorCode> cases[] = {
+        { "",                      ErrorCode::UnexpectedEnd       },
+        { "[1,]",                  ErrorCode::InvalidLiteral      },
+        { "[1 2]",                 ErrorCode::UnexpectedCharacter },
+        { "{\"a\" 1}",             ErrorCode::UnexpectedCharacter },
+        { "{\"a\":1,}",            ErrorCode::UnexpectedCharacter },
+        { "[01]",                  ErrorCode::InvalidNumber       },
+        { "[1.]",                  ErrorCode::InvalidNumber       },
+        { "[.5]",                  ErrorCode::InvalidLiteral      },
+        { "[-]",                   ErrorCode::InvalidNumber       },
+        { "[+1]",                  ErrorCode::InvalidLiteral      },
+        { "[1e]",                  ErrorCode::InvalidNumber       },
+        { "[1e+]",                 ErrorCode::InvalidNumber       },
+        { "[1x]",                  ErrorCode::InvalidNumber       },
+        { "[tru]",                 ErrorCode::InvalidLiteral      },
+        { "[truex]",               ErrorCode::InvalidLiteral      },
+        { "[\"\\x\"]",            ErrorCode::InvalidEscape       },
+        { "[\"\\u12g4\"]",        ErrorCode::InvalidEscape       },
+        { "[\"a\tb\"]",            ErrorCode::ControlCharacter    },
+        { "[\"\xc0\xaf\"]",        ErrorCode::InvalidUtf8         },
+        { "[\"\xed\xa0\x80\"]",    ErrorCode::InvalidUtf8         },
+        { "[\"\xf4\x90\x80\x80\"]", ErrorCode::InvalidUtf8        },
+        { "[\"\xe2\x82\"]",        ErrorCode::InvalidUtf8         },
+        { "[1] [2]",               ErrorCode::TrailingCharacters  },
+        { "[\"unterminated]",      ErrorCode::UnexpectedEnd       },
+    };
+    for (const auto& [data, code] : cases) {
+        CHECK(codeOf(data) == code);
+        const auto parsed = tryParseStrict(data);
+        CHECK(!parsed.hasValue() && parsed.error().code == code);
+        CHECK(parsed.error().position == validate(data)->position);
+    }
+    CHECK(codeOf(std::string(1025, '[') + std::string(1025, ']')) == ErrorCode::TooDeep);
+}
+
+SIMPLE_JSON_TEST(validatorReportsTheFirstError) {
+    CHECK(validate("[1,]")->position == 3);
+    CHECK(validate("[\"\xff\", 1,]")->code == ErrorCode::InvalidUtf8);
+    CHECK(validate("[1,,\"\xff\"]")->position == 3);
+    CHECK(validate("[1] x")->position == 4);
+}
+
+SIMPLE_JSON_TEST(validatorAcceptsLargeNumbersThatParsingRejects) {
+    for (const auto* huge : { "[1e400]", "[-325432.2036e86739]" }) {
+        CHECK(isValid(huge));
+        const auto parsed = tryParseStrict(huge);
+        CHECK(!parsed.hasValue() && parsed.error().code == ErrorCode::InvalidNumber);
+        CHECK_THROWS(parse(huge), Exception);
+    }
+    CHECK(parseStrict("[1e-400]").as<ValueType::Array>()[0].as<ValueType::Double>() == 0);
+}
@@ -0,0 +1,86 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "allocations.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+/** A document whose strings and containers do not fit into any small buffer. */
+static constexpr std::string_view data = R"({
+    "name": "a string longer than any small-string buffer",
+    "list": [[1, 2, 3], {"nested": {"deeper": {"text": "another string longer than a small-string buffer"}}}],
+    "count": 42, "flag": true, "none": null
+})";
+
+SIMPLE_JSON_TEST(accessorsDoNotCopy) {
+    auto value = parse(data);
+    const auto counter = AllocationCounter();
+
+    const auto& object = value.as<ValueType::Object>();
+    CHECK(&object == &std::get<ObjectContent>(value.value));
+    const auto& list = object.at("list").as<ValueType::Array>();
+    CHECK(&list == &std::get<ArrayContent>(object.at("list").value));
+    CHECK(list.at(0).as<ValueType::Array>().size() == 3);
+    CHECK(object.at("name").as<ValueType::String>().size() > 40);
+    CHECK(object.at("name").asStringView().data() == object.at("name").as<ValueType::String>().data());
+    CHECK(object.at("count").as<ValueType::Int>() == 42);
+
+    const auto view = ObjectView(value);
+    CHECK(&view.getContent() == &object);
+    CHECK(view.getStringViewBang("name") == object.at("name").asStringView());
+    CHECK(view.getBang<ValueType::Array>("list").size() == 2);
+    const auto& deeper = view.getBang<ValueType::Array>("list").at(1).as<ValueType::Object>();
+    CHECK(ObjectView(deeper).getObjectBang("nested").getObjectBang("deeper").getStringView("text")->size() > 40);
+    CHECK(view.get<ValueType::Bool>("flag") == true);
+    CHECK(!view.getObject("none").has_value());
+
+    const auto wrapper = Object(std::move(value));
+    CHECK(wrapper.view().getBang<ValueType::Int>("count") == 42);
+    CHECK(wrapper.getStringViewBang("name").size() > 40);
+
+    CHECK(counter.getCount() == 0);
+}
+
+SIMPLE_JSON_TEST(documentAccessorsDoNotCopy) {
+    const auto document = Document(data);
+    const auto counter  = AllocationCounter();
+
+    const auto root = ObjectView(document.getRoot());
+    CHECK(root.getStringViewBang("name").data() > document.getData().data());
+    const auto& list = root.getBang<ValueType::Array>("list");
+    CHECK(ObjectView(list.at(1)).getObjectBang("nested").getObjectBang("deeper").getStringViewBang("text").size() > 40);
+    CHECK(list.at(0).as<ValueType::Array>().at(2).as<ValueType::Int>() == 3);
+
+    CHECK(counter.getCount() == 0);
+}
+
+SIMPLE_JSON_TEST(parseTypedMovesTheRoot) {
+    auto counter = AllocationCounter();
+    const auto value = parse(data);
+    const auto parsed = counter.getCount();
+
+    counter = AllocationCounter();
+    const auto object = parse<ValueType::Object>(data);
+    CHECK(counter.getCount() == parsed);
+    CHECK(object.size() == value.as<ValueType::Object>().size());
+}
@@ -0,0 +1,106 @@
+/*
+ * SimpleJSON - Simple yet flexible JSON parser for C++
+ *
+ * Written in 2024 - 2025 by mhahnFr
+ *
+ * This file is part of SimpleJSON.
+ *
+ * To the extent possible under law, the author(s) have dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * You should have received a copy of the CC0 Public Domain Dedication along with SimpleJSON,
+ * see the file LICENSE. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <SimpleJSON/SimpleJSON.hpp>
+
+#include "corpus.hpp"
+#include "test.hpp"
+
+using namespace simple_json;
+using namespace simple_json::test;
+
+SIMPLE_JSON_TEST(writerMatchesSerialize) {
+    for (const auto& document : documents()) {
+        const auto value = parse(document);
+        std::string written;
+        Writer writer([&written](std::string_view data) { written += data; });
+        writer.value(value);
+        writer.flush();
+        CHECK(written == serialize(value));
+        CHECK(dump(parse(written)) == dump(value));
+        CHECK(dump(parse(serialize(value, { true, 4 }))) == dump(value));
+    }
+}
+
+SIMPLE_JSON_TEST(writerFormatsPretty) {
+    const auto value = parse(R"({"a": [1, {}, []], "b": {"c": null}})");
+    CHECK(serialize(value) == R"({"a":[1,{},[]],"b":{"c":null}})");
+    CHECK(serialize(value, { true, 2 }) == "{\n  \"a\": [\n    1,\n    {},\n    []\n  ],\n  \"b\": {\n    \"c\": null\n  }\n}");
+}
+
+SIMPLE_JSON_TEST(writerEscapesStrings) {
+    auto writer = Writer();
+    writer.string("\"\\/\b\f\n\r\t\x01\x1f\x7f \xc3\xa9");
+    CHECK(writer.take() == "\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001f\x7f \xc3\xa9\"");
+
+    std::ostringstream stream;
+    Writer streamed(stream);
+    streamed.startArray();
+    streamed.boolean(false);
+    streamed.integer(-12);
+    streamed.endArray();
+    CHECK(stream.str().empty());
+    streamed.flush();
+    CHECK(stream.str() == "[false,-12]");
+}
+
+SIMPLE_JSON_TEST(writerFlushesWhenDestroyed) {
+    std::ostringstream stream;
+    {
+        Writer writer(stream);
+        writer.startArray();
+        writer.integer(1);
+        writer.string("two");
+        writer.endArray();
+        CHECK(stream.str().empty());
+    }
+    CHECK(stream.str() == R"([1,"two"])");
+}
+
+SIMPLE_JSON_TEST(writerFlushesOnceWhenMoved) {
+    std::string written;
+    {
+        Writer writer([&written](std::string_view data) { written += data; });
+        writer.startArray();
+        writer.null();
+        auto moved = std::move(writer);
+        moved.endArray();
+
+        Writer other([&written](std::string_view data) { written += data; });
+        other.boolean(true);
+        other = std::move(moved);
+        CHECK(written == "true");
+    }
+    CHECK(written == "true[null]");
+}
+
+SIMPLE_JSON_TEST(writerIgnoresSinkErrorsWhenDestroyed) {
+    const auto throwing = [](std::string_view) { throw std::runtime_error("sink"); };
+    {
+        Writer writer(throwing);
+        writer.null();
+        CHECK_THROWS(writer.flush(), std::runtime_error);
+    }
+    {
+        Writer writer(throwing);
+        writer.null();
+    }
+}